@@ -5,6 +5,7 @@
 // Author: Lorenzo Leone <lleone@iis.ee.ethz.ch>
 
 `include "axi/assign.svh"
+`include "common_cells/assertions.svh"
 `include "common_cells/registers.svh"
 
 module spm_tile
@@ -131,7 +132,7 @@ module spm_tile
   floo_nw_chimney #(
     .AxiCfgN             (AxiCfgN),
     .AxiCfgW             (AxiCfgW),
-    .ChimneyCfgN         (set_ports(ChimneyDefaultCfg, bit'(IsNarrow), 1'b0)),
+    .ChimneyCfgN         (set_ports(ChimneyDefaultCfg, 1'b1, 1'b0)),
     .ChimneyCfgW         (set_ports(ChimneyDefaultCfg, bit'(!IsNarrow), 1'b0)),
     .RouteCfg            (RouteCfgNoMcast),
     .AtopSupport         (1'b1),
@@ -181,10 +182,10 @@ module spm_tile
     assign axi_narrow_rsp       = axi_to_chimney_rsp;
     assign axi_wide_rsp         = '0;
   end else begin : gen_wide_spm
-    // Connect the Wide chimney ports downstream and tie off the Narrow chimney ports
+    // Connect the Wide chimney ports downstream, the Narrow chimney ports
+    // are served by a separate narrow port into the banks (see below)
     assign axi_from_chimney_req = axi_wide_req;
     assign axi_wide_rsp         = axi_to_chimney_rsp;
-    assign axi_narrow_rsp       = '0;
   end
 
   /////////////////
@@ -265,6 +266,148 @@ module spm_tile
 
   `FF(mem_req_q, mem_req_d, '0)
 
+  /////////////////
+  // Narrow port //
+  /////////////////
+
+  // In the wide tile, narrow accesses are converted to memory requests of
+  // their own and arbitrated with the wide requests on every bank. Wide
+  // requests always have priority, so bursts are never stalled, while
+  // single-word narrow accesses avoid a DMA round trip. Every narrow word
+  // maps to a lane of a bank word, which requires
+  // `SpmDataWidth >= AxiCfgN.DataWidth`.
+
+  localparam int unsigned NarrowDataWidth = AxiCfgN.DataWidth;
+  localparam int unsigned NarrowLaneOffset = $clog2(NarrowDataWidth / 8);
+  localparam int unsigned NarrowLaneSelWidth = (SpmDataWidth > NarrowDataWidth) ? $clog2(
+      SpmDataWidth / NarrowDataWidth
+  ) : 32'd0;
+
+  typedef logic [NarrowDataWidth-1:0] narrow_data_t;
+  typedef logic [NarrowDataWidth/8-1:0] narrow_strb_t;
+  typedef logic [(SpmBankSelWidth > 0) ? SpmBankSelWidth-1 : 0:0] bank_sel_t;
+  typedef logic [(NarrowLaneSelWidth > 0) ? NarrowLaneSelWidth-1 : 0:0] lane_sel_t;
+
+  logic narrow_req, narrow_gnt, narrow_we, narrow_rvalid_q;
+  mem_addr_t    narrow_addr;
+  narrow_data_t narrow_wdata, narrow_rdata;
+  narrow_strb_t narrow_strb;
+  bank_sel_t narrow_bank_d, narrow_bank_q;
+  lane_sel_t narrow_lane_d, narrow_lane_q;
+  // Granted narrow request, for every bank
+  logic [SpmNumBanksPerWord-1:0] narrow_bank_req;
+
+  if (!IsNarrow) begin : gen_narrow_port
+    // The narrow word selects a lane of the bank word, below the bank index
+    `ASSERT_INIT(NarrowLaneWidth, SpmDataWidth % NarrowDataWidth == 0,
+                 "The SPM data width must be a multiple of the narrow data width")
+    `ASSERT_INIT(NarrowLaneSel, NarrowLaneOffset + NarrowLaneSelWidth == SpmBankSelOffset,
+                 "The narrow lane index must lie right below the bank index")
+    `ASSERT_INIT(NarrowBankSel, SpmNumBanksPerWord == 2 ** SpmBankSelWidth,
+                 "The number of banks per word must be a power of two")
+
+    axi_narrow_out_req_t axi_narrow_filter_req, axi_narrow_cut_req;
+    axi_narrow_out_rsp_t axi_narrow_filter_rsp, axi_narrow_cut_rsp;
+
+    axi_atop_filter #(
+      .AxiIdWidth     (AxiCfgN.InIdWidth),
+      .AxiMaxWriteTxns(1),
+      .axi_req_t      (axi_narrow_out_req_t),
+      .axi_resp_t     (axi_narrow_out_rsp_t)
+    ) i_narrow_axi_atop_filter (
+      .clk_i,
+      .rst_ni,
+      .slv_req_i (axi_narrow_req),
+      .slv_resp_o(axi_narrow_rsp),
+      .mst_req_o (axi_narrow_filter_req),
+      .mst_resp_i(axi_narrow_filter_rsp)
+    );
+
+    axi_cut #(
+      .aw_chan_t (axi_narrow_out_aw_chan_t),
+      .w_chan_t  (axi_narrow_out_w_chan_t),
+      .b_chan_t  (axi_narrow_out_b_chan_t),
+      .ar_chan_t (axi_narrow_out_ar_chan_t),
+      .r_chan_t  (axi_narrow_out_r_chan_t),
+      .axi_req_t (axi_narrow_out_req_t),
+      .axi_resp_t(axi_narrow_out_rsp_t)
+    ) i_narrow_axi_cut (
+      .clk_i,
+      .rst_ni,
+      .slv_req_i (axi_narrow_filter_req),
+      .slv_resp_o(axi_narrow_filter_rsp),
+      .mst_req_o (axi_narrow_cut_req),
+      .mst_resp_i(axi_narrow_cut_rsp)
+    );
+
+    axi_to_mem #(
+      .axi_req_t   (axi_narrow_out_req_t),
+      .axi_resp_t  (axi_narrow_out_rsp_t),
+      .AddrWidth   ($clog2(SpmTileSize)),
+      .DataWidth   (NarrowDataWidth),
+      .IdWidth     (AxiCfgN.InIdWidth),
+      .NumBanks    (1),
+      .BufDepth    (1),
+      .HideStrb    (1'b0),
+      .OutFifoDepth(1)
+    ) i_narrow_axi_to_mem (
+      .clk_i,
+      .rst_ni,
+      .busy_o      (),
+      .axi_req_i   (axi_narrow_cut_req),
+      .axi_resp_o  (axi_narrow_cut_rsp),
+      .mem_req_o   (narrow_req),
+      .mem_gnt_i   (narrow_gnt),
+      .mem_addr_o  (narrow_addr),
+      .mem_wdata_o (narrow_wdata),
+      .mem_strb_o  (narrow_strb),
+      .mem_atop_o  (),
+      .mem_we_o    (narrow_we),
+      .mem_rvalid_i(narrow_rvalid_q),
+      .mem_rdata_i (narrow_rdata)
+    );
+
+    // Select the bank and the lane within the bank word
+    if (SpmBankSelWidth > 0) begin : gen_narrow_bank_sel
+      assign narrow_bank_d = narrow_addr[SpmBankSelOffset+:SpmBankSelWidth];
+    end else begin : gen_no_narrow_bank_sel
+      assign narrow_bank_d = '0;
+    end
+    if (NarrowLaneSelWidth > 0) begin : gen_narrow_lane_sel
+      assign narrow_lane_d = narrow_addr[NarrowLaneOffset+:NarrowLaneSelWidth];
+    end else begin : gen_no_narrow_lane_sel
+      assign narrow_lane_d = '0;
+    end
+
+    // Wide requests have priority on the bank
+    assign narrow_gnt = !mem_req_d[narrow_bank_d];
+    for (genvar b = 0; b < SpmNumBanksPerWord; b++) begin : gen_narrow_bank_req
+      assign narrow_bank_req[b] = narrow_req && narrow_gnt && (narrow_bank_d == b);
+    end
+
+    `FF(narrow_rvalid_q, narrow_req && narrow_gnt, '0)
+    `FF(narrow_bank_q, narrow_bank_d, '0)
+    `FF(narrow_lane_q, narrow_lane_d, '0)
+
+    assign narrow_rdata = mem_rdata[narrow_bank_q][narrow_lane_q*NarrowDataWidth+:NarrowDataWidth];
+
+  end else begin : gen_no_narrow_port
+    // The narrow tile is served by the main port
+    assign narrow_req      = 1'b0;
+    assign narrow_gnt      = 1'b0;
+    assign narrow_we       = 1'b0;
+    assign narrow_addr     = '0;
+    assign narrow_wdata    = '0;
+    assign narrow_strb     = '0;
+    assign narrow_bank_d   = '0;
+    assign narrow_bank_q   = '0;
+    assign narrow_lane_d   = '0;
+    assign narrow_lane_q   = '0;
+    assign narrow_rvalid_q = 1'b0;
+    assign narrow_rdata    = '0;
+    assign narrow_bank_req = '0;
+  end
+
   ///////////////
   // SPM SRAM //
   ///////////////
@@ -280,12 +423,17 @@ module spm_tile
   row_sel_t spm_bank_row_sel_q, spm_bank_row_sel_d;
 
   for (genvar b = 0; b < SpmNumBanksPerWord; b++) begin : gen_spm_addressing
+    mem_addr_t bank_addr;
+
+    // Select the bank request, either from axi_to_mem or from the narrow port
+    assign bank_addr = narrow_bank_req[b] ? narrow_addr : mem_addr[b];
+
     // Select the SPM address bits
-    assign spm_addr[b] = mem_addr[b][SpmAddrWidthOffset+:SpmAddrWidth];
+    assign spm_addr[b] = bank_addr[SpmAddrWidthOffset+:SpmAddrWidth];
 
     // Select the correct spm req rows
     if (SpmRowSelWidth > 0) begin : gen_spm_row_sel
-      assign spm_bank_row_sel_d[b] = mem_addr[b][SpmRowSelOffset+:SpmRowSelWidth];
+      assign spm_bank_row_sel_d[b] = bank_addr[SpmRowSelOffset+:SpmRowSelWidth];
     end else begin : gen_no_spm_row_sel
       assign spm_bank_row_sel_d[b] = '0;  // No row selection, always select row 0
     end
@@ -293,11 +441,14 @@ module spm_tile
     // Select the correct SPM bank row for read data
     assign mem_rdata[b] = spm_rdata[spm_bank_row_sel_q[b]][b];
 
-    // 1-to-1 mapping for SPm signals coming from axi_to_mem
-    assign spm_wdata[b] = mem_wdata[b];
-    assign spm_strb[b]  = mem_strb[b];
-    assign spm_we[b]    = mem_we[b];
-    assign spm_req[b]   = mem_req_d[b];
+    // Narrow writes are replicated on all lanes and masked by the strobe
+    assign spm_wdata[b] = narrow_bank_req[b] ?
+                          {(SpmDataWidth / NarrowDataWidth){narrow_wdata}} : mem_wdata[b];
+    assign spm_strb[b]  = narrow_bank_req[b] ?
+                          mem_strb_t'(narrow_strb) << (narrow_lane_d * NarrowDataWidth / 8) :
+                          mem_strb[b];
+    assign spm_we[b]    = narrow_bank_req[b] ? narrow_we : mem_we[b];
+    assign spm_req[b]   = mem_req_d[b] || narrow_bank_req[b];
   end
   `FF(spm_bank_row_sel_q, spm_bank_row_sel_d, '0)
 
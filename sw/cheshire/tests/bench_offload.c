@@ -0,0 +1,121 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Offloads a benchmark from `sw/snitch/bench` to all clusters, like
+// `simple_offload.c`, and prints the results it collected over the UART,
+// one line per workload:
+//
+//   [bench] <name> cycles=<n> flop=<n> flop_per_cycle=<x.yyy> peak=<n>
+//           l1_bytes=<n> l2_bytes=<n>
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "pb_bench.h"
+
+#include "regs/cheshire.h"
+#include "dif/clint.h"
+#include "dif/uart.h"
+#include "params.h"
+#include "util.h"
+
+#include "snitch_cluster_cfg.h"
+
+// This needs to be in a region which is not cached
+volatile uint32_t (*return_code_array)[CFG_CLUSTER_NR_CORES] = (uint32_t (*)[CFG_CLUSTER_NR_CORES])0x707FF000;
+
+static void print_str(const char *str) {
+  uint32_t len = 0;
+  while (str[len]) len++;
+  uart_write_str(&__base_uart, (void *)str, len);
+}
+
+// Print an unsigned number, padded with zeros to at least `digits` digits
+static void print_uint(uint64_t value, uint32_t digits) {
+  char buf[21];
+  uint32_t i = sizeof(buf) - 1;
+  buf[i] = '\0';
+  do {
+    buf[--i] = '0' + (value % 10);
+    value /= 10;
+  } while (value || sizeof(buf) - 1 - i < digits);
+  print_str(&buf[i]);
+}
+
+static void print_result(pb_bench_result_t *res) {
+  char name[PB_BENCH_NAME_LEN + 1];
+  for (uint32_t i = 0; i < PB_BENCH_NAME_LEN; i++) name[i] = res->name[i];
+  name[PB_BENCH_NAME_LEN] = '\0';
+  uint64_t milli = res->cycles ? (res->flop * 1000) / res->cycles : 0;
+
+  print_str("[bench] ");
+  print_str(name);
+  print_str(" cycles=");
+  print_uint(res->cycles, 1);
+  print_str(" flop=");
+  print_uint(res->flop, 1);
+  print_str(" flop_per_cycle=");
+  print_uint(milli / 1000, 1);
+  print_str(".");
+  print_uint(milli % 1000, 3);
+  print_str(" peak=");
+  print_uint(res->peak, 1);
+  print_str(" l1_bytes=");
+  print_uint(res->bytes[PB_BENCH_L1], 1);
+  print_str(" l2_bytes=");
+  print_uint(res->bytes[PB_BENCH_L2], 1);
+  print_str("\r\n");
+}
+
+int main() {
+  uint32_t rtc_freq = *reg32(&__base_regs, CHESHIRE_RTC_FREQ_REG_OFFSET);
+  uint64_t reset_freq = clint_get_core_freq(rtc_freq, 2500);
+  uart_init(&__base_uart, reset_freq, __BOOT_BAUDRATE);
+
+  pb_bench_table_t *table = pb_bench_table();
+  table->num_results = 0;
+
+  // Write entry point to scratch register 1
+  // and return code address to scratch register 0
+  // Initalize return address loaction before offloading.
+  for (int i = 0; i < SNRT_CLUSTER_NUM; i++) {
+    *(volatile uint64_t *)&(picobello_addrmap.cluster[i].peripheral_reg.scratch[1].w) = (uintptr_t)&picobello_addrmap.l2_spm;
+    *(volatile uint64_t *)&(picobello_addrmap.cluster[i].peripheral_reg.scratch[0].w) = (uintptr_t)&return_code_array[i];
+    for (int j = 0; j < CFG_CLUSTER_NR_CORES; j++) {
+      return_code_array[i][j] = 0;
+    }
+  }
+
+  // Start all cores in Cluster 0, which will wake up all other clusters
+  *(volatile uint64_t *)&(picobello_addrmap.cluster[0].peripheral_reg.cl_clint_set.w) = (1 << CFG_CLUSTER_NR_CORES) - 1;
+
+  // Wait until all cores have finished
+  int all_finished = 0;
+  while (!all_finished) {
+    all_finished = 1;
+    for (int i = 0; i < SNRT_CLUSTER_NUM; i++) {
+      for (int j = 0; j < CFG_CLUSTER_NR_CORES; j++) {
+        if ((return_code_array[i][j] & 1) == 0) {
+          all_finished = 0;
+          break;
+        }
+      }
+    }
+  }
+
+  // Sum up the return codes
+  uint32_t sum = 0;
+  for (int i = 0; i < SNRT_CLUSTER_NUM; i++) {
+    for (int j = 0; j < CFG_CLUSTER_NR_CORES; j++) {
+      sum += (return_code_array[i][j] >> 1);
+    }
+  }
+
+  // Report the results, also if the benchmark failed its checks
+  uint32_t num_results = table->num_results;
+  if (num_results > PB_BENCH_MAX_RESULTS) num_results = PB_BENCH_MAX_RESULTS;
+  for (uint32_t i = 0; i < num_results; i++) print_result(&table->results[i]);
+  uart_write_flush(&__base_uart);
+
+  return sum;
+}
@@ -0,0 +1,59 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Host-driven staging of DRAM-resident data through the L2 page cache.
+// The host stages pages into L2 ahead of their use, reads and updates
+// them through the cache and flushes the dirty pages back to DRAM. All
+// copies are synchronous, done word by word by the host.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "pb_page_cache.h"
+
+#define PAGE_SIZE    1024
+#define NUM_FRAMES   4
+#define NUM_PAGES    10
+#define REGION_WORDS (NUM_PAGES * PAGE_SIZE / sizeof(uint32_t))
+#define REGION_ADDR  (PB_DRAM_BASE + 0x10000000)
+
+// Cache and frames in an L2 tile not used by the program
+#define CACHE_ADDR   ((uintptr_t)&picobello_addrmap.l2_spm + sizeof(picobello_addrmap__l2_spm_t))
+#define FRAMES_ADDR  (CACHE_ADDR + 0x1000)
+
+static void copy_words(void *dst, const void *src, size_t size) {
+  volatile uint32_t *d = (volatile uint32_t *)dst;
+  volatile const uint32_t *s = (volatile const uint32_t *)src;
+  for (size_t i = 0; i < size / sizeof(uint32_t); i++) d[i] = s[i];
+}
+
+int main() {
+  uint32_t n_errs = 0;
+  pb_page_cache_t *cache = (pb_page_cache_t *)CACHE_ADDR;
+  volatile uint32_t *region = (volatile uint32_t *)REGION_ADDR;
+  uint32_t frame;
+
+  pb_page_cache_init(cache, (void *)FRAMES_ADDR, NUM_FRAMES, PAGE_SIZE);
+  for (uint32_t i = 0; i < REGION_WORDS; i++) region[i] = i;
+
+  // Staged pages are hits afterwards
+  n_errs += pb_page_stage_with(cache, REGION_ADDR, copy_words);
+  pb_page_slot_t slot = pb_page_reserve(cache, REGION_ADDR);
+  n_errs += (slot.status != PB_PAGE_HIT);
+  pb_page_release(cache, slot.frame, 0);
+
+  // Increment every word, evicting dirty pages along the way
+  for (uint32_t i = 0; i < REGION_WORDS; i++) {
+    uint64_t addr = REGION_ADDR + i * sizeof(uint32_t);
+    uint32_t *word = (uint32_t *)pb_page_get_with(cache, addr, &frame, copy_words);
+    if (!word) return 1;
+    n_errs += (*word != i);
+    *word += 1;
+    pb_page_release(cache, frame, 1);
+  }
+  pb_page_flush_with(cache, copy_words);
+
+  for (uint32_t i = 0; i < REGION_WORDS; i++) n_errs += (region[i] != i + 1);
+
+  return n_errs;
+}
@@ -0,0 +1,54 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Streaming over the serial link, in the burst preload mode (PRELMODE=4).
+// The host echoes every chunk streamed in by the testbench back to it, and
+// appends it to a region which the testbench dumps at the end. Both the
+// output stream and the dump must match the input file. Run with:
+//
+//   STREAM_IN=<file> STREAM_IN_ADDR=70200000
+//   STREAM_OUT=<file> STREAM_OUT_ADDR=70210000
+//   DUMP=<file> DUMP_ADDR=70220000 DUMP_SIZE=12288
+//
+// where the input file holds STREAM_BYTES bytes.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "pb_slink_stream.h"
+
+#define STREAM_BYTES 12288
+
+// Mailboxes and dump region in an L2 tile not used by the program
+#define STREAM_BASE     ((uintptr_t)&picobello_addrmap.l2_spm + 2 * sizeof(picobello_addrmap__l2_spm_t))
+#define STREAM_IN_ADDR  (STREAM_BASE + 0x00000)
+#define STREAM_OUT_ADDR (STREAM_BASE + 0x10000)
+#define DUMP_ADDR       (STREAM_BASE + 0x20000)
+
+static void copy_words(void *dst, const void *src, size_t size) {
+  volatile uint32_t *d = (volatile uint32_t *)dst;
+  volatile const uint32_t *s = (volatile const uint32_t *)src;
+  for (size_t i = 0; i < size / sizeof(uint32_t); i++) d[i] = s[i];
+}
+
+int main() {
+  pb_slink_stream_t *in = (pb_slink_stream_t *)STREAM_IN_ADDR;
+  pb_slink_stream_t *out = (pb_slink_stream_t *)STREAM_OUT_ADDR;
+  uint8_t *dump = (uint8_t *)DUMP_ADDR;
+  uint32_t total = 0;
+  uint32_t len;
+
+  while ((len = pb_slink_stream_wait(in))) {
+    // Chunks are padded to full words by the testbench
+    if (total + len > STREAM_BYTES) return 1;
+    pb_slink_stream_flush(out);
+    copy_words(out->data, in->data, len);
+    copy_words(dump + total, in->data, len);
+    pb_slink_stream_release(in);
+    pb_slink_stream_push(out, len);
+    total += len;
+  }
+  pb_slink_stream_close(out);
+
+  return total != STREAM_BYTES;
+}
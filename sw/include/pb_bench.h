@@ -0,0 +1,49 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Result table of the end-to-end benchmarks.
+//
+// The benchmarks in `sw/snitch/bench` append one record per workload to a
+// table at a fixed L2 address. Once all clusters returned, the offload
+// program of Cheshire (`sw/cheshire/tests/bench_offload.c`) prints the
+// records over the UART, where `util/bench_check.py` compares them against
+// the checked-in baselines.
+
+#pragma once
+
+#include <stdint.h>
+
+// Next to the return codes of the offload programs, in a region which is
+// not cached by Cheshire
+#define PB_BENCH_TABLE_ADDR 0x707FE000
+
+#define PB_BENCH_MAX_RESULTS 16
+#define PB_BENCH_NAME_LEN 24
+
+// Memory levels for which the moved bytes are reported
+#define PB_BENCH_L1 0
+#define PB_BENCH_L2 1
+#define PB_BENCH_NUM_LEVELS 2
+
+// All fields are sized and aligned identically on RV32 and RV64
+typedef struct {
+    char name[PB_BENCH_NAME_LEN];
+    // End-to-end cycles of the workload on all clusters
+    uint32_t cycles;
+    // Peak FLOP/cycle of the system at the precision of the workload
+    uint32_t peak;
+    uint64_t flop;
+    // Bytes moved to and from every memory level
+    uint64_t bytes[PB_BENCH_NUM_LEVELS];
+} pb_bench_result_t;
+
+typedef struct {
+    volatile uint32_t num_results;
+    uint32_t reserved;
+    pb_bench_result_t results[PB_BENCH_MAX_RESULTS];
+} pb_bench_table_t;
+
+static inline pb_bench_table_t *pb_bench_table(void) {
+    return (pb_bench_table_t *)(uintptr_t)PB_BENCH_TABLE_ADDR;
+}
@@ -0,0 +1,329 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// L2 residency cache for data stored in external DRAM.
+//
+// Tensors which do not fit in L2 are kept in DRAM and staged through a
+// pool of page frames in L2. The cache tracks which DRAM page resides in
+// which frame, and evicts the least recently used unpinned page on a miss.
+// Pages are pinned while in use, and dirty pages are written back to DRAM
+// before their frame is reused.
+//
+// The cache metadata lives in L2 and is shared by the host and all
+// clusters, so this header only depends on the compiler atomics. The
+// actual data movement is left to the user of the cache. The clusters
+// stage pages asynchronously with their DMA (see `pb_paging.h` in the
+// Snitch runtime). The `_with` helpers of this header stage pages
+// synchronously with a copy function, so the host is blocked for the
+// whole page and nothing overlaps with the copy. A caller with an
+// asynchronous copy engine can instead reserve a frame with
+// `pb_page_reserve`, issue the transfers and publish the frame with
+// `pb_page_mark_valid` once they complete.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// External DRAM, reachable through Cheshire
+#define PB_DRAM_BASE 0x80000000ULL
+#define PB_DRAM_SIZE 0x80000000ULL
+
+#define PB_PAGE_CACHE_MAX_FRAMES 64
+
+// Frame states
+#define PB_PAGE_EMPTY 0
+#define PB_PAGE_LOADING 1
+#define PB_PAGE_VALID 2
+
+// Outcomes of a reservation
+#define PB_PAGE_HIT 0
+#define PB_PAGE_MISS 1
+#define PB_PAGE_FULL 2
+#define PB_PAGE_BUSY 3
+
+// All fields are sized identically on RV32 and RV64
+typedef struct {
+    // DRAM address of the resident page
+    volatile uint64_t tag;
+    volatile uint32_t state;
+    // Number of users pinning the page
+    volatile uint32_t refcnt;
+    volatile uint32_t dirty;
+    // Value of the cache clock at the last use
+    volatile uint32_t last_use;
+    uint32_t reserved;
+    // DRAM address of the evicted page while it is written back
+    volatile uint64_t wb_tag;
+} pb_page_frame_t;
+
+typedef struct {
+    volatile uint32_t lock;
+    volatile uint32_t clock;
+    uint32_t num_frames;
+    uint32_t page_size;
+    // L2 address of the first frame, frames are contiguous
+    uint64_t frame_base;
+    pb_page_frame_t frames[PB_PAGE_CACHE_MAX_FRAMES];
+} pb_page_cache_t;
+
+typedef struct {
+    uint32_t status;
+    uint32_t frame;
+    // DRAM address to write the previous content of the frame back to,
+    // zero if no write-back is needed
+    uint64_t writeback;
+} pb_page_slot_t;
+
+static inline void pb_page_cache_lock(pb_page_cache_t *cache) {
+    while (__atomic_exchange_n(&cache->lock, 1, __ATOMIC_ACQUIRE));
+}
+
+static inline void pb_page_cache_unlock(pb_page_cache_t *cache) {
+    __atomic_store_n(&cache->lock, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Initialize a page cache. Must be called by a single core.
+ *
+ * @param frames      L2 buffer of `num_frames * page_size` bytes
+ * @param num_frames  Number of page frames, at most
+ *                    PB_PAGE_CACHE_MAX_FRAMES
+ * @param page_size   Page size in bytes, a power of two
+ */
+static inline void pb_page_cache_init(pb_page_cache_t *cache, void *frames,
+                                      uint32_t num_frames, uint32_t page_size) {
+    cache->lock = 0;
+    cache->clock = 0;
+    cache->num_frames = num_frames;
+    cache->page_size = page_size;
+    cache->frame_base = (uintptr_t)frames;
+    for (uint32_t i = 0; i < num_frames; i++) {
+        cache->frames[i].tag = 0;
+        cache->frames[i].state = PB_PAGE_EMPTY;
+        cache->frames[i].refcnt = 0;
+        cache->frames[i].dirty = 0;
+        cache->frames[i].last_use = 0;
+        cache->frames[i].wb_tag = 0;
+    }
+}
+
+// DRAM address of the page containing `addr`
+static inline uint64_t pb_page_base(pb_page_cache_t *cache, uint64_t addr) {
+    return addr & ~(uint64_t)(cache->page_size - 1);
+}
+
+// L2 address of a frame
+static inline void *pb_page_frame_ptr(pb_page_cache_t *cache, uint32_t frame) {
+    return (void *)(uintptr_t)(cache->frame_base +
+                               (uint64_t)frame * cache->page_size);
+}
+
+/**
+ * @brief Look up the page containing `addr` and pin it, reserving a frame
+ *        on a miss.
+ *
+ * On a hit, the page may still be loading, see `pb_page_wait`. On a miss,
+ * the frame is returned in the LOADING state: the caller must write back
+ * its previous content if requested, load the page and then call
+ * `pb_page_mark_valid`. PB_PAGE_FULL is returned if all frames are pinned,
+ * PB_PAGE_BUSY if the page is being written back and must be requested
+ * again later.
+ */
+static inline pb_page_slot_t pb_page_reserve(pb_page_cache_t *cache,
+                                             uint64_t addr) {
+    pb_page_slot_t slot;
+    uint64_t tag = pb_page_base(cache, addr);
+    uint32_t victim = cache->num_frames;
+
+    pb_page_cache_lock(cache);
+    uint32_t now = ++cache->clock;
+    for (uint32_t i = 0; i < cache->num_frames; i++) {
+        pb_page_frame_t *f = &cache->frames[i];
+        if (f->wb_tag == tag) {
+            pb_page_cache_unlock(cache);
+            slot.status = PB_PAGE_BUSY;
+            slot.frame = i;
+            slot.writeback = 0;
+            return slot;
+        }
+        if (f->state != PB_PAGE_EMPTY && f->tag == tag) {
+            f->refcnt = f->refcnt + 1;
+            f->last_use = now;
+            pb_page_cache_unlock(cache);
+            slot.status = PB_PAGE_HIT;
+            slot.frame = i;
+            slot.writeback = 0;
+            return slot;
+        }
+        // Prefer empty frames, then the least recently used unpinned one
+        if (f->state == PB_PAGE_EMPTY) {
+            if (victim == cache->num_frames ||
+                cache->frames[victim].state != PB_PAGE_EMPTY)
+                victim = i;
+        } else if (f->state == PB_PAGE_VALID && f->refcnt == 0) {
+            if (victim == cache->num_frames ||
+                (cache->frames[victim].state != PB_PAGE_EMPTY &&
+                 f->last_use < cache->frames[victim].last_use))
+                victim = i;
+        }
+    }
+
+    if (victim == cache->num_frames) {
+        pb_page_cache_unlock(cache);
+        slot.status = PB_PAGE_FULL;
+        slot.frame = 0;
+        slot.writeback = 0;
+        return slot;
+    }
+
+    pb_page_frame_t *f = &cache->frames[victim];
+    slot.status = PB_PAGE_MISS;
+    slot.frame = victim;
+    slot.writeback =
+        (f->state == PB_PAGE_VALID && f->dirty) ? f->tag : 0;
+    f->wb_tag = slot.writeback;
+    f->tag = tag;
+    f->state = PB_PAGE_LOADING;
+    f->refcnt = 1;
+    f->dirty = 0;
+    f->last_use = now;
+    pb_page_cache_unlock(cache);
+    return slot;
+}
+
+// Publish a frame once its page has been loaded. The write-back of the
+// previous page must be complete.
+static inline void pb_page_mark_valid(pb_page_cache_t *cache, uint32_t frame) {
+    cache->frames[frame].wb_tag = 0;
+    __atomic_store_n(&cache->frames[frame].state, PB_PAGE_VALID,
+                     __ATOMIC_RELEASE);
+}
+
+// Wait until a pinned frame has been loaded
+static inline void pb_page_wait(pb_page_cache_t *cache, uint32_t frame) {
+    while (__atomic_load_n(&cache->frames[frame].state, __ATOMIC_ACQUIRE) !=
+           PB_PAGE_VALID);
+}
+
+/**
+ * @brief Unpin a frame.
+ *
+ * @param dirty  Non-zero if the page was modified and must be written back
+ *               to DRAM before eviction
+ */
+static inline void pb_page_release(pb_page_cache_t *cache, uint32_t frame,
+                                   uint32_t dirty) {
+    pb_page_cache_lock(cache);
+    if (dirty) cache->frames[frame].dirty = 1;
+    cache->frames[frame].refcnt = cache->frames[frame].refcnt - 1;
+    pb_page_cache_unlock(cache);
+}
+
+// Unpin a frame and drop its page from the cache if it is not in use.
+// Returns zero if the page is still pinned by other users.
+static inline uint32_t pb_page_discard(pb_page_cache_t *cache,
+                                       uint32_t frame) {
+    uint32_t dropped = 0;
+    pb_page_cache_lock(cache);
+    cache->frames[frame].refcnt = cache->frames[frame].refcnt - 1;
+    if (cache->frames[frame].refcnt == 0) {
+        cache->frames[frame].state = PB_PAGE_EMPTY;
+        cache->frames[frame].dirty = 0;
+        dropped = 1;
+    }
+    pb_page_cache_unlock(cache);
+    return dropped;
+}
+
+/**
+ * @brief Pin a frame for writing back a dirty page, e.g. to flush the
+ *        cache.
+ *
+ * @return DRAM address of the page, zero if the frame holds no unpinned
+ *         dirty page. The frame must be released after the write-back.
+ */
+static inline uint64_t pb_page_reserve_writeback(pb_page_cache_t *cache,
+                                                 uint32_t frame) {
+    uint64_t tag = 0;
+    pb_page_frame_t *f = &cache->frames[frame];
+    pb_page_cache_lock(cache);
+    if (f->state == PB_PAGE_VALID && f->dirty && f->refcnt == 0) {
+        f->refcnt = 1;
+        f->dirty = 0;
+        tag = f->tag;
+    }
+    pb_page_cache_unlock(cache);
+    return tag;
+}
+
+typedef void (*pb_page_copy_t)(void *dst, const void *src, size_t size);
+
+/**
+ * @brief Pin the page containing `addr`, staging it synchronously with
+ *        the given copy function on a miss.
+ *
+ * @return Pointer to `addr` in L2, NULL if all frames are pinned. The page
+ *         must be released with `pb_page_release`, the frame index is
+ *         returned in `frame`.
+ */
+static inline void *pb_page_get_with(pb_page_cache_t *cache, uint64_t addr,
+                                     uint32_t *frame, pb_page_copy_t copy) {
+    pb_page_slot_t slot;
+    do {
+        slot = pb_page_reserve(cache, addr);
+    } while (slot.status == PB_PAGE_BUSY);
+    if (slot.status == PB_PAGE_FULL) return NULL;
+    void *ptr = pb_page_frame_ptr(cache, slot.frame);
+    if (slot.status == PB_PAGE_MISS) {
+        if (slot.writeback)
+            copy((void *)(uintptr_t)slot.writeback, ptr, cache->page_size);
+        copy(ptr, (const void *)(uintptr_t)pb_page_base(cache, addr),
+             cache->page_size);
+        pb_page_mark_valid(cache, slot.frame);
+    } else {
+        pb_page_wait(cache, slot.frame);
+    }
+    *frame = slot.frame;
+    return (uint8_t *)ptr + (addr - pb_page_base(cache, addr));
+}
+
+/**
+ * @brief Make the page containing `addr` resident, without pinning it.
+ *
+ * The page is staged synchronously with the given copy function, so this
+ * only moves the copy ahead of the use of the page, e.g. from the host
+ * before the clusters start computing.
+ *
+ * @return Zero if the page is resident, non-zero if it could not be staged
+ *         because all frames are pinned or the page is being written back.
+ */
+static inline uint32_t pb_page_stage_with(pb_page_cache_t *cache,
+                                          uint64_t addr,
+                                          pb_page_copy_t copy) {
+    pb_page_slot_t slot = pb_page_reserve(cache, addr);
+    if (slot.status == PB_PAGE_FULL || slot.status == PB_PAGE_BUSY) return 1;
+    if (slot.status == PB_PAGE_MISS) {
+        void *ptr = pb_page_frame_ptr(cache, slot.frame);
+        if (slot.writeback)
+            copy((void *)(uintptr_t)slot.writeback, ptr, cache->page_size);
+        copy(ptr, (const void *)(uintptr_t)pb_page_base(cache, addr),
+             cache->page_size);
+        pb_page_mark_valid(cache, slot.frame);
+    }
+    pb_page_release(cache, slot.frame, 0);
+    return 0;
+}
+
+// Write back all unpinned dirty pages with the given copy function
+static inline void pb_page_flush_with(pb_page_cache_t *cache,
+                                      pb_page_copy_t copy) {
+    for (uint32_t i = 0; i < cache->num_frames; i++) {
+        uint64_t tag = pb_page_reserve_writeback(cache, i);
+        if (!tag) continue;
+        copy((void *)(uintptr_t)tag, pb_page_frame_ptr(cache, i),
+             cache->page_size);
+        pb_page_release(cache, i, 0);
+    }
+}
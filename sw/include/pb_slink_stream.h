@@ -0,0 +1,72 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Streaming mailbox for serial link transfers in simulation.
+//
+// In the serial link burst preload mode, the testbench can stream a file
+// into memory and collect data produced by the program into a file while
+// the program runs (see `slink_stream_in` and `slink_stream_out` in
+// `target/sim/include/tb_picobello_tasks.svh`). Both directions use a
+// mailbox with a single chunk in flight: the length word is zero when the
+// mailbox is empty, the chunk length once the producer filled the data
+// area, and PB_SLINK_STREAM_EOF once the producer is done. The testbench
+// empties both mailboxes before launching the program, and waits for the
+// streams to end once the program exited.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PB_SLINK_STREAM_EOF 0xFFFFFFFFu
+#define PB_SLINK_STREAM_DATA_OFFSET 64
+
+typedef struct {
+    volatile uint32_t len;
+    uint8_t reserved[PB_SLINK_STREAM_DATA_OFFSET - sizeof(uint32_t)];
+    uint8_t data[];
+} pb_slink_stream_t;
+
+/**
+ * @brief Wait for the next chunk streamed in by the testbench.
+ *
+ * @return Length of the chunk in bytes, or 0 at the end of the stream. The
+ *         chunk must be released with `pb_slink_stream_release` once it has
+ *         been consumed.
+ */
+static inline uint32_t pb_slink_stream_wait(pb_slink_stream_t *mbox) {
+    uint32_t len;
+    while ((len = mbox->len) == 0);
+    return (len == PB_SLINK_STREAM_EOF) ? 0 : len;
+}
+
+// Hand an input chunk back to the testbench
+static inline void pb_slink_stream_release(pb_slink_stream_t *mbox) {
+    mbox->len = 0;
+}
+
+/**
+ * @brief Publish a chunk written to the data area of an output mailbox.
+ *
+ * Blocks until the testbench collected the previous chunk. Since the data
+ * area is shared with the previous chunk, call `pb_slink_stream_flush`
+ * before writing it.
+ *
+ * @param len  Number of bytes in the data area
+ */
+static inline void pb_slink_stream_push(pb_slink_stream_t *mbox, uint32_t len) {
+    while (mbox->len != 0);
+    mbox->len = len;
+}
+
+// Wait until the previous output chunk was collected
+static inline void pb_slink_stream_flush(pb_slink_stream_t *mbox) {
+    while (mbox->len != 0);
+}
+
+// Signal the end of an output stream
+static inline void pb_slink_stream_close(pb_slink_stream_t *mbox) {
+    pb_slink_stream_flush(mbox);
+    mbox->len = PB_SLINK_STREAM_EOF;
+}
@@ -0,0 +1,287 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Harness shared by the end-to-end benchmarks.
+//
+// A benchmark runs on all cores of all clusters. Its data is staged in L2
+// (the program's globals) and moved to the TCDM of every cluster with the
+// DMA. Every workload is enclosed between `bench_begin` and `bench_end`,
+// which measure the end-to-end cycles on all clusters and record the
+// result in the table of `pb_bench.h`, together with the FLOP and the bytes
+// moved per memory level. The DM cores account for the moved bytes: the
+// DMA transfers issued through the harness for L2, and the estimates given
+// by the kernels for L1.
+//
+// The kernels are plain C loops, so that the results track the hardware
+// and the runtime rather than hand-tuned kernels. The reported utilization
+// is relative to the SIMD FMA peak of the FPUs (see `bench_peak`), which
+// these scalar loops cannot attain: without SSRs and FREP, their loads and
+// loop overhead stall the FPU, and they issue one FMA per element, i.e. at
+// most half of the FP32 peak.
+
+#pragma once
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "pb_bench.h"
+#include "snrt.h"
+
+// TCDM scratch region of every cluster used by the kernels
+#define BENCH_L1_SIZE 0x18000
+
+typedef struct {
+    uint8_t *l1;
+    // Bytes moved by the cluster per memory level, updated by the DM core
+    uint64_t *bytes;
+    uint32_t start;
+} bench_t;
+
+// Bytes moved by every cluster in the current workload
+uint64_t bench_cluster_bytes[SNRT_CLUSTER_NUM][PB_BENCH_NUM_LEVELS];
+
+/* Setup and measurement */
+
+// Allocate the scratch region and counters. Must be called by all cores.
+static inline void bench_init(bench_t *b) {
+  b->l1 = (uint8_t *)snrt_l1_alloc_cluster_local(BENCH_L1_SIZE, 64);
+  b->bytes = (uint64_t *)snrt_l1_alloc_cluster_local(PB_BENCH_NUM_LEVELS * sizeof(uint64_t), 8);
+  b->start = 0;
+  if (snrt_is_dm_core()) {
+    for (uint32_t l = 0; l < PB_BENCH_NUM_LEVELS; l++) b->bytes[l] = 0;
+  }
+}
+
+// Peak FLOP/cycle of the system for elements of `elem_size` bytes, if
+// every core retires one SIMD FMA on 64 bits per cycle. This is the peak
+// of the hardware, not what the scalar kernels of this harness attain.
+static inline uint32_t bench_peak(uint32_t elem_size) {
+  return snrt_cluster_num() * snrt_cluster_compute_core_num() * 2 * (8 / elem_size);
+}
+
+// Account for bytes moved by the cluster. Must be called by the DM core.
+static inline void bench_count(bench_t *b, uint32_t level, uint64_t bytes) {
+  b->bytes[level] += bytes;
+}
+
+// Start the measurement of a workload. Must be called by all cores.
+static inline void bench_begin(bench_t *b) {
+  snrt_global_barrier();
+  if (snrt_cluster_idx() == 0 && snrt_is_dm_core()) b->start = snrt_mcycle();
+}
+
+/**
+ * @brief Stop the measurement of a workload and record its result.
+ *
+ * Must be called by all cores.
+ *
+ * @param name       Name of the workload, at most PB_BENCH_NAME_LEN chars
+ * @param flop       Floating-point operations of the workload
+ * @param elem_size  Element size in bytes, which determines the peak
+ */
+static inline void bench_end(bench_t *b, const char *name, uint64_t flop, uint32_t elem_size) {
+  uint32_t cluster = snrt_cluster_idx();
+  snrt_global_barrier();
+  uint32_t cycles = snrt_mcycle() - b->start;
+
+  if (snrt_is_dm_core()) {
+    for (uint32_t l = 0; l < PB_BENCH_NUM_LEVELS; l++) {
+      bench_cluster_bytes[cluster][l] = b->bytes[l];
+      b->bytes[l] = 0;
+    }
+  }
+  snrt_global_barrier();
+
+  if (cluster == 0 && snrt_is_dm_core()) {
+    pb_bench_table_t *table = pb_bench_table();
+    if (table->num_results < PB_BENCH_MAX_RESULTS) {
+      pb_bench_result_t *res = &table->results[table->num_results];
+      uint32_t i = 0;
+      for (; i < PB_BENCH_NAME_LEN && name[i]; i++) res->name[i] = name[i];
+      for (; i < PB_BENCH_NAME_LEN; i++) res->name[i] = '\0';
+      res->cycles = cycles;
+      res->peak = bench_peak(elem_size);
+      res->flop = flop;
+      for (uint32_t l = 0; l < PB_BENCH_NUM_LEVELS; l++) {
+        res->bytes[l] = 0;
+        for (uint32_t c = 0; c < snrt_cluster_num(); c++) res->bytes[l] += bench_cluster_bytes[c][l];
+      }
+      table->num_results = table->num_results + 1;
+    }
+  }
+}
+
+/* Data movement, issued by the DM core */
+
+static inline snrt_dma_txid_t bench_dma_1d(bench_t *b, void *dst, const void *src, size_t size) {
+  bench_count(b, PB_BENCH_L2, size);
+  return snrt_dma_start_1d(dst, (void *)src, size);
+}
+
+static inline snrt_dma_txid_t bench_dma_2d(bench_t *b, void *dst, const void *src, size_t size,
+                                           size_t dst_stride, size_t src_stride, size_t repeat) {
+  bench_count(b, PB_BENCH_L2, size * repeat);
+  return snrt_dma_start_2d(dst, (void *)src, size, dst_stride, src_stride, repeat);
+}
+
+/* Data initialization */
+
+// Deterministic test value in [-0.5, 0.5)
+static inline double bench_value(uint32_t i, uint32_t seed) {
+  return (double)((i * 2654435761u + seed * 40503u) % 1024) / 1024.0 - 0.5;
+}
+
+// Fill an L2 array, split over the compute cores of all clusters
+static inline void bench_fill(void *ptr, uint32_t n, uint32_t elem_size, uint32_t seed) {
+  if (!snrt_is_compute_core()) return;
+  uint32_t num = snrt_cluster_num() * snrt_cluster_compute_core_num();
+  uint32_t idx = snrt_cluster_idx() * snrt_cluster_compute_core_num() + snrt_cluster_core_idx();
+  for (uint32_t i = idx; i < n; i += num) {
+    if (elem_size == sizeof(double))
+      ((double *)ptr)[i] = bench_value(i, seed);
+    else
+      ((float *)ptr)[i] = (float)bench_value(i, seed);
+  }
+}
+
+// Rows [*begin, *end) of `rows` assigned to the calling cluster
+static inline void bench_cluster_rows(uint32_t rows, uint32_t *begin, uint32_t *end) {
+  uint32_t per_cluster = (rows + snrt_cluster_num() - 1) / snrt_cluster_num();
+  *begin = snrt_cluster_idx() * per_cluster;
+  *end = *begin + per_cluster;
+  if (*begin > rows) *begin = rows;
+  if (*end > rows) *end = rows;
+}
+
+/* Compute kernels, executed by the compute cores of a cluster */
+
+/**
+ * @brief Matrix product of TCDM operands, split over the compute cores.
+ *
+ * Computes `c[i][j] = act(sum_k a[i][k] * b[k][j])` with row-major
+ * operands. Consecutive cores compute consecutive columns, so that their
+ * accesses to `b` and `c` fall on distinct banks.
+ *
+ * @param relu  Apply a ReLU to the result if non-zero
+ */
+static inline void bench_mm_fp64(double *c, const double *a, const double *b, uint32_t m,
+                                 uint32_t n, uint32_t k, uint32_t relu) {
+  if (!snrt_is_compute_core()) return;
+  uint32_t ncores = snrt_cluster_compute_core_num();
+  for (uint32_t e = snrt_cluster_core_idx(); e < m * n; e += ncores) {
+    uint32_t i = e / n;
+    uint32_t j = e % n;
+    double acc = 0.0;
+    for (uint32_t kk = 0; kk < k; kk++) acc += a[i * k + kk] * b[kk * n + j];
+    c[e] = (relu && acc < 0.0) ? 0.0 : acc;
+  }
+}
+
+static inline void bench_mm_fp32(float *c, const float *a, const float *b, uint32_t m, uint32_t n,
+                                 uint32_t k, uint32_t relu) {
+  if (!snrt_is_compute_core()) return;
+  uint32_t ncores = snrt_cluster_compute_core_num();
+  for (uint32_t e = snrt_cluster_core_idx(); e < m * n; e += ncores) {
+    uint32_t i = e / n;
+    uint32_t j = e % n;
+    float acc = 0.0f;
+    for (uint32_t kk = 0; kk < k; kk++) acc += a[i * k + kk] * b[kk * n + j];
+    c[e] = (relu && acc < 0.0f) ? 0.0f : acc;
+  }
+}
+
+// L1 bytes loaded and stored by a matrix product
+static inline uint64_t bench_mm_l1_bytes(uint32_t m, uint32_t n, uint32_t k, uint32_t elem_size) {
+  return (uint64_t)m * n * (2 * k + 1) * elem_size;
+}
+
+/**
+ * @brief Row-partitioned GEMM of L2 operands on all clusters.
+ *
+ * Computes `c = act(a * b)` with row-major `a` of `m` x `k`, `b` of `k` x
+ * `n` and `c` of `m` x `n`. Every cluster computes a block of rows of `c`:
+ * it loads its rows of `a` once and streams `b` in tiles of `tn` columns,
+ * double-buffered, while the results are written back to L2. Must be
+ * called by all cores of all clusters.
+ *
+ * The scratch region must hold the rows of `a` of one cluster, two tiles of
+ * `b` and two tiles of `c`.
+ *
+ * @param elem_size  8 for FP64 or 4 for FP32 operands
+ * @param tn         Tile width, must divide `n`
+ */
+static inline void bench_gemm(bench_t *bn, void *c, const void *a, const void *b, uint32_t m,
+                              uint32_t n, uint32_t k, uint32_t tn, uint32_t elem_size,
+                              uint32_t relu) {
+  uint32_t r0, r1;
+  bench_cluster_rows(m, &r0, &r1);
+  uint32_t mc = r1 - r0;
+  if (!mc) return;
+
+  uint32_t tiles = n / tn;
+  uint8_t *a_l1 = bn->l1;
+  uint8_t *b_l1[2], *c_l1[2];
+  b_l1[0] = a_l1 + mc * k * elem_size;
+  b_l1[1] = b_l1[0] + k * tn * elem_size;
+  c_l1[0] = b_l1[1] + k * tn * elem_size;
+  c_l1[1] = c_l1[0] + mc * tn * elem_size;
+  const uint8_t *a_l2 = (const uint8_t *)a + r0 * k * elem_size;
+  uint8_t *c_l2 = (uint8_t *)c + r0 * n * elem_size;
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(bn, a_l1, a_l2, mc * k * elem_size);
+    bench_dma_2d(bn, b_l1[0], b, tn * elem_size, tn * elem_size, n * elem_size, k);
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+
+  for (uint32_t t = 0; t < tiles; t++) {
+    if (snrt_is_dm_core()) {
+      // Prefetch the next tile of `b` and write back the previous tile of `c`
+      if (t + 1 < tiles) {
+        bench_dma_2d(bn, b_l1[(t + 1) % 2], (const uint8_t *)b + (t + 1) * tn * elem_size,
+                     tn * elem_size, tn * elem_size, n * elem_size, k);
+      }
+      if (t > 0) {
+        bench_dma_2d(bn, c_l2 + (t - 1) * tn * elem_size, c_l1[(t - 1) % 2], tn * elem_size,
+                     n * elem_size, tn * elem_size, mc);
+      }
+      bench_count(bn, PB_BENCH_L1, bench_mm_l1_bytes(mc, tn, k, elem_size));
+      snrt_dma_wait_all();
+    } else if (elem_size == sizeof(double)) {
+      bench_mm_fp64((double *)c_l1[t % 2], (const double *)a_l1, (const double *)b_l1[t % 2], mc,
+                    tn, k, relu);
+    } else {
+      bench_mm_fp32((float *)c_l1[t % 2], (const float *)a_l1, (const float *)b_l1[t % 2], mc, tn,
+                    k, relu);
+    }
+    snrt_cluster_hw_barrier();
+  }
+
+  if (snrt_is_dm_core()) {
+    bench_dma_2d(bn, c_l2 + (tiles - 1) * tn * elem_size, c_l1[(tiles - 1) % 2], tn * elem_size,
+                 n * elem_size, tn * elem_size, mc);
+    snrt_dma_wait_all();
+  }
+}
+
+/* Reference computations for the checks */
+
+// Element (i, j) of the product of row-major L2 operands
+static inline double bench_ref_mm(const void *a, const void *b, uint32_t i, uint32_t j, uint32_t n,
+                                  uint32_t k, uint32_t elem_size) {
+  double acc = 0.0;
+  for (uint32_t kk = 0; kk < k; kk++) {
+    if (elem_size == sizeof(double))
+      acc += ((const double *)a)[i * k + kk] * ((const double *)b)[kk * n + j];
+    else
+      acc += (double)((const float *)a)[i * k + kk] * (double)((const float *)b)[kk * n + j];
+  }
+  return acc;
+}
+
+static inline uint32_t bench_close(double value, double ref, double tol) {
+  double diff = value - ref;
+  if (diff < 0.0) diff = -diff;
+  return diff <= tol * (1.0 + (ref < 0.0 ? -ref : ref));
+}
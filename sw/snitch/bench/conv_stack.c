@@ -0,0 +1,133 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Stack of 3x3 FP64 convolutions with ReLU, on zero-padded CHW images in
+// L2. The output rows of every layer are partitioned over the clusters.
+// Every cluster loads the input rows it needs, including the halo, lowers
+// them to an im2col matrix with the DMA and computes its rows as a matrix
+// product with the weights. A sample of the last layer is checked by
+// cluster 0.
+
+#include <stdint.h>
+#include "bench.h"
+
+/* Parameters */
+#define H          16
+#define W          16
+#define HP         (H + 2)
+#define WP         (W + 2)
+#define K          3
+#define N_LAYERS   3
+#define MAX_C      16
+#define N_SAMPLES  8
+
+static const uint32_t channels[N_LAYERS + 1] = {8, 16, 16, 16};
+
+double act_l2[N_LAYERS + 1][MAX_C * HP * WP];
+double weights_l2[N_LAYERS][MAX_C * MAX_C * K * K];
+
+/* Helper functions */
+// Fill the interior of a padded image, or zero it entirely
+static void init_image(double *img, uint32_t c, uint32_t seed, uint32_t zero) {
+  if (!snrt_is_compute_core()) return;
+  uint32_t num = snrt_cluster_num() * snrt_cluster_compute_core_num();
+  uint32_t idx = snrt_cluster_idx() * snrt_cluster_compute_core_num() + snrt_cluster_core_idx();
+  for (uint32_t i = idx; i < c * HP * WP; i += num) {
+    uint32_t y = (i / WP) % HP;
+    uint32_t x = i % WP;
+    uint32_t border = (y == 0 || y == HP - 1 || x == 0 || x == WP - 1);
+    img[i] = (zero || border) ? 0.0 : bench_value(i, seed);
+  }
+}
+
+static void conv_layer(bench_t *b, double *out, const double *in, const double *weights,
+                       uint32_t cin, uint32_t cout) {
+  uint32_t y0, y1;
+  bench_cluster_rows(H, &y0, &y1);
+  uint32_t rows = y1 - y0;
+  if (!rows) return;
+
+  uint32_t hs = rows + K - 1;
+  uint32_t npix = rows * W;
+  uint32_t kdim = cin * K * K;
+  double *w_l1 = (double *)b->l1;
+  double *sub_l1 = w_l1 + cout * kdim;
+  double *col_l1 = sub_l1 + cin * hs * WP;
+  double *out_l1 = col_l1 + kdim * npix;
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(b, w_l1, weights, cout * kdim * sizeof(double));
+    // Input rows of all channels, including the halo
+    bench_dma_2d(b, sub_l1, in + y0 * WP, hs * WP * sizeof(double), hs * WP * sizeof(double),
+                 HP * WP * sizeof(double), cin);
+    snrt_dma_wait_all();
+    pb_dma_im2col(col_l1, sub_l1, cin, hs, WP, K, K, 1, sizeof(double));
+    bench_count(b, PB_BENCH_L1, 2ull * kdim * npix * sizeof(double));
+    bench_count(b, PB_BENCH_L1, bench_mm_l1_bytes(cout, npix, kdim, sizeof(double)));
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+
+  bench_mm_fp64(out_l1, w_l1, col_l1, cout, npix, kdim, 1);
+  snrt_cluster_hw_barrier();
+
+  // Write the rows of every output channel to the interior of the image
+  if (snrt_is_dm_core()) {
+    for (uint32_t co = 0; co < cout; co++) {
+      bench_dma_2d(b, out + (co * HP + y0 + 1) * WP + 1, out_l1 + co * npix, W * sizeof(double),
+                   WP * sizeof(double), W * sizeof(double), rows);
+    }
+    snrt_dma_wait_all();
+  }
+}
+
+static uint32_t check(void) {
+  uint32_t n_errs = 0;
+  uint32_t cin = channels[N_LAYERS - 1];
+  uint32_t cout = channels[N_LAYERS];
+  const double *in = act_l2[N_LAYERS - 1];
+  const double *w = weights_l2[N_LAYERS - 1];
+  for (uint32_t s = 0; s < N_SAMPLES; s++) {
+    uint32_t co = (s * 5) % cout;
+    uint32_t y = (s * 7 + 3) % H;
+    uint32_t x = (s * 11 + 1) % W;
+    double ref = 0.0;
+    for (uint32_t ci = 0; ci < cin; ci++) {
+      for (uint32_t ki = 0; ki < K; ki++) {
+        for (uint32_t kj = 0; kj < K; kj++) {
+          ref += w[co * cin * K * K + (ci * K + ki) * K + kj] * in[(ci * HP + y + ki) * WP + x + kj];
+        }
+      }
+    }
+    if (ref < 0.0) ref = 0.0;
+    n_errs += !bench_close(act_l2[N_LAYERS][(co * HP + y + 1) * WP + x + 1], ref, 1e-9);
+  }
+  return n_errs;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  uint64_t flop = 0;
+  bench_t bench;
+  bench_init(&bench);
+
+  for (uint32_t l = 0; l <= N_LAYERS; l++) init_image(act_l2[l], channels[l], 1, l > 0);
+  for (uint32_t l = 0; l < N_LAYERS; l++) {
+    bench_fill(weights_l2[l], channels[l + 1] * channels[l] * K * K, sizeof(double), l + 2);
+    flop += 2ull * channels[l + 1] * channels[l] * K * K * H * W;
+  }
+
+  bench_begin(&bench);
+  for (uint32_t l = 0; l < N_LAYERS; l++) {
+    conv_layer(&bench, act_l2[l + 1], act_l2[l], weights_l2[l], channels[l], channels[l + 1]);
+    // The next layer reads the halo rows computed by the neighbouring clusters
+    snrt_global_barrier();
+  }
+  bench_end(&bench, "conv_stack", flop, sizeof(double));
+
+  if (snrt_cluster_idx() == 0 && snrt_cluster_core_idx() == 0) n_errs += check();
+
+  return n_errs;
+}
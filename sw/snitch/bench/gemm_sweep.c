@@ -0,0 +1,82 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// GEMM sweep over square problem sizes and precisions. Every workload
+// computes `C = A * B` with all operands in L2, the rows of `C` being
+// partitioned over the clusters (see `bench_gemm`). A sample of the results
+// is checked against a reference computed by cluster 0.
+
+#include <stdint.h>
+#include "bench.h"
+
+/* Parameters */
+#define MAX_SIZE  128
+#define TILE_N    32
+#define N_SAMPLES 8
+
+static const uint32_t sizes[] = {32, 64, 128};
+static const uint32_t elem_sizes[] = {sizeof(double), sizeof(float)};
+
+double a_l2[MAX_SIZE * MAX_SIZE];
+double b_l2[MAX_SIZE * MAX_SIZE];
+double c_l2[MAX_SIZE * MAX_SIZE];
+
+/* Helper functions */
+static uint32_t check(uint32_t size, uint32_t elem_size) {
+  uint32_t n_errs = 0;
+  double tol = (elem_size == sizeof(double)) ? 1e-9 : 1e-4;
+  for (uint32_t s = 0; s < N_SAMPLES; s++) {
+    uint32_t i = (s * 37) % size;
+    uint32_t j = (s * 53 + 11) % size;
+    double ref = bench_ref_mm(a_l2, b_l2, i, j, size, size, elem_size);
+    double value = (elem_size == sizeof(double)) ? c_l2[i * size + j]
+                                                  : ((float *)c_l2)[i * size + j];
+    n_errs += !bench_close(value, ref, tol);
+  }
+  return n_errs;
+}
+
+static void workload_name(char *name, uint32_t size, uint32_t elem_size) {
+  const char *prefix = (elem_size == sizeof(double)) ? "gemm_fp64_" : "gemm_fp32_";
+  uint32_t len = 0;
+  while (prefix[len]) {
+    name[len] = prefix[len];
+    len++;
+  }
+  if (size >= 100) name[len++] = '0' + size / 100;
+  if (size >= 10) name[len++] = '0' + (size / 10) % 10;
+  name[len++] = '0' + size % 10;
+  name[len] = '\0';
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  bench_t bench;
+  bench_init(&bench);
+
+  for (uint32_t p = 0; p < sizeof(elem_sizes) / sizeof(elem_sizes[0]); p++) {
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+      uint32_t size = sizes[s];
+      uint32_t elem_size = elem_sizes[p];
+      char name[PB_BENCH_NAME_LEN];
+      workload_name(name, size, elem_size);
+
+      bench_fill(a_l2, size * size, elem_size, 1);
+      bench_fill(b_l2, size * size, elem_size, 2);
+
+      bench_begin(&bench);
+      bench_gemm(&bench, c_l2, a_l2, b_l2, size, size, size, TILE_N, elem_size, 0);
+      bench_end(&bench, name, 2ull * size * size * size, elem_size);
+
+      if (snrt_cluster_idx() == 0 && snrt_cluster_core_idx() == 0) {
+        n_errs += check(size, elem_size);
+      }
+      // Keep the operands until they are checked
+      snrt_global_barrier();
+    }
+  }
+
+  return n_errs;
+}
@@ -0,0 +1,245 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// FP64 transformer encoder block, with all activations and weights in L2:
+//
+//   qkv = x * Wqkv
+//   y   = LayerNorm(x + Attention(qkv) * Wo)
+//   out = LayerNorm(y + ReLU(y * W1) * W2)
+//
+// The tokens are partitioned over the clusters. Every cluster computes the
+// attention of its queries over all keys and values, which requires a
+// global barrier after the QKV projection. All other steps only use the
+// rows of the cluster. The reported FLOP cover the matrix products.
+// Cluster 0 checks a sample of the QKV projection and the normalization of
+// the output.
+
+#include <stdint.h>
+#include "bench.h"
+
+/* Parameters */
+#define S         32  // Tokens
+#define D         64  // Model dimension
+#define NH        2   // Attention heads
+#define DH        (D / NH)
+#define F         128 // FFN dimension
+#define TILE_N    32
+#define LN_EPS    1e-5
+// 1 / sqrt(DH)
+#define ATT_SCALE 0.17677669529663687
+#define N_SAMPLES 8
+
+double x_l2[S * D];
+double wqkv_l2[D * 3 * D];
+double qkv_l2[S * 3 * D];
+double att_l2[S * D];
+double wo_l2[D * D];
+double proj_l2[S * D];
+double y_l2[S * D];
+double w1_l2[D * F];
+double h_l2[S * F];
+double w2_l2[F * D];
+double z_l2[S * D];
+double out_l2[S * D];
+
+/* Helper functions */
+// exp(x) by range reduction to [0, ln 2) and a Taylor polynomial
+static double bench_exp(double x) {
+  const double ln2 = 0.6931471805599453;
+  if (x < -700.0) return 0.0;
+  int32_t n = (int32_t)(x / ln2);
+  if (n * ln2 > x) n--;
+  double r = x - n * ln2;
+  double term = 1.0, sum = 1.0;
+  for (uint32_t i = 1; i <= 12; i++) {
+    term *= r / i;
+    sum += term;
+  }
+  union {
+    uint64_t u;
+    double d;
+  } scale;
+  scale.u = (uint64_t)(n + 1023) << 52;
+  return sum * scale.d;
+}
+
+// 1 / sqrt(x) with Newton iterations
+static double bench_rsqrt(double x) {
+  union {
+    uint64_t u;
+    double d;
+  } y;
+  y.d = x;
+  y.u = 0x5FE6EB50C7B537A9ull - (y.u >> 1);
+  for (uint32_t i = 0; i < 5; i++) y.d = y.d * (1.5 - 0.5 * x * y.d * y.d);
+  return y.d;
+}
+
+// Multi-head attention of the queries of the cluster over all tokens
+static void attention(bench_t *b) {
+  uint32_t r0, r1;
+  bench_cluster_rows(S, &r0, &r1);
+  uint32_t mc = r1 - r0;
+  if (!mc) return;
+
+  uint32_t core = snrt_cluster_core_idx();
+  uint32_t ncores = snrt_cluster_compute_core_num();
+  double *qkv = (double *)b->l1;
+  double *p = qkv + S * 3 * D;
+  double *o = p + mc * NH * S;
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(b, qkv, qkv_l2, S * 3 * D * sizeof(double));
+    bench_count(b, PB_BENCH_L1, (uint64_t)mc * NH * S * (2 * DH + 1) * sizeof(double));
+    bench_count(b, PB_BENCH_L1, (uint64_t)mc * D * (2 * S + 1) * sizeof(double));
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+
+  // Scaled scores of every query, head and key
+  if (snrt_is_compute_core()) {
+    for (uint32_t e = core; e < mc * NH * S; e += ncores) {
+      uint32_t i = e / (NH * S);
+      uint32_t h = (e / S) % NH;
+      uint32_t j = e % S;
+      const double *q = &qkv[(r0 + i) * 3 * D + h * DH];
+      const double *k = &qkv[j * 3 * D + D + h * DH];
+      double acc = 0.0;
+      for (uint32_t c = 0; c < DH; c++) acc += q[c] * k[c];
+      p[e] = acc * ATT_SCALE;
+    }
+  }
+  snrt_cluster_hw_barrier();
+
+  // Softmax over the keys
+  if (snrt_is_compute_core()) {
+    for (uint32_t t = core; t < mc * NH; t += ncores) {
+      double *row = &p[t * S];
+      double max = row[0], sum = 0.0;
+      for (uint32_t j = 1; j < S; j++) max = row[j] > max ? row[j] : max;
+      for (uint32_t j = 0; j < S; j++) {
+        row[j] = bench_exp(row[j] - max);
+        sum += row[j];
+      }
+      for (uint32_t j = 0; j < S; j++) row[j] /= sum;
+    }
+  }
+  snrt_cluster_hw_barrier();
+
+  // Weighted sum of the values
+  if (snrt_is_compute_core()) {
+    for (uint32_t e = core; e < mc * D; e += ncores) {
+      uint32_t i = e / D;
+      uint32_t col = e % D;
+      const double *pr = &p[(i * NH + col / DH) * S];
+      double acc = 0.0;
+      for (uint32_t j = 0; j < S; j++) acc += pr[j] * qkv[j * 3 * D + 2 * D + col];
+      o[e] = acc;
+    }
+  }
+  snrt_cluster_hw_barrier();
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(b, att_l2 + r0 * D, o, mc * D * sizeof(double));
+    snrt_dma_wait_all();
+  }
+}
+
+// out = LayerNorm(a + r) on the rows of the cluster
+static void add_norm(bench_t *b, double *out, const double *a, const double *r) {
+  uint32_t r0, r1;
+  bench_cluster_rows(S, &r0, &r1);
+  uint32_t mc = r1 - r0;
+  if (!mc) return;
+
+  uint32_t core = snrt_cluster_core_idx();
+  uint32_t ncores = snrt_cluster_compute_core_num();
+  double *a_l1 = (double *)b->l1;
+  double *r_l1 = a_l1 + mc * D;
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(b, a_l1, a + r0 * D, mc * D * sizeof(double));
+    bench_dma_1d(b, r_l1, r + r0 * D, mc * D * sizeof(double));
+    bench_count(b, PB_BENCH_L1, 6ull * mc * D * sizeof(double));
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+
+  if (snrt_is_compute_core()) {
+    for (uint32_t e = core; e < mc * D; e += ncores) a_l1[e] += r_l1[e];
+  }
+  snrt_cluster_hw_barrier();
+
+  if (snrt_is_compute_core()) {
+    for (uint32_t i = core; i < mc; i += ncores) {
+      double *row = &a_l1[i * D];
+      double mean = 0.0, var = 0.0;
+      for (uint32_t c = 0; c < D; c++) mean += row[c];
+      mean /= D;
+      for (uint32_t c = 0; c < D; c++) var += (row[c] - mean) * (row[c] - mean);
+      double inv = bench_rsqrt(var / D + LN_EPS);
+      for (uint32_t c = 0; c < D; c++) row[c] = (row[c] - mean) * inv;
+    }
+  }
+  snrt_cluster_hw_barrier();
+
+  if (snrt_is_dm_core()) {
+    bench_dma_1d(b, out + r0 * D, a_l1, mc * D * sizeof(double));
+    snrt_dma_wait_all();
+  }
+}
+
+static uint32_t check(void) {
+  uint32_t n_errs = 0;
+  for (uint32_t s = 0; s < N_SAMPLES; s++) {
+    uint32_t i = (s * 5) % S;
+    uint32_t j = (s * 29 + 7) % (3 * D);
+    double ref = bench_ref_mm(x_l2, wqkv_l2, i, j, 3 * D, D, sizeof(double));
+    n_errs += !bench_close(qkv_l2[i * 3 * D + j], ref, 1e-9);
+
+    // Every output row is normalized
+    double mean = 0.0, var = 0.0;
+    for (uint32_t c = 0; c < D; c++) mean += out_l2[i * D + c];
+    mean /= D;
+    for (uint32_t c = 0; c < D; c++) var += (out_l2[i * D + c] - mean) * (out_l2[i * D + c] - mean);
+    var /= D;
+    n_errs += !bench_close(mean, 0.0, 1e-9);
+    n_errs += !bench_close(var, 1.0, 1e-3);
+  }
+  return n_errs;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  bench_t bench;
+  bench_init(&bench);
+
+  bench_fill(x_l2, S * D, sizeof(double), 1);
+  bench_fill(wqkv_l2, D * 3 * D, sizeof(double), 2);
+  bench_fill(wo_l2, D * D, sizeof(double), 3);
+  bench_fill(w1_l2, D * F, sizeof(double), 4);
+  bench_fill(w2_l2, F * D, sizeof(double), 5);
+
+  uint64_t flop = 2ull * S * D * 3 * D  // QKV projection
+                  + 4ull * S * S * D    // Scores and weighted sum
+                  + 2ull * S * D * D    // Output projection
+                  + 4ull * S * D * F;   // FFN
+
+  bench_begin(&bench);
+  bench_gemm(&bench, qkv_l2, x_l2, wqkv_l2, S, 3 * D, D, TILE_N, sizeof(double), 0);
+  // The attention reads the keys and values of all clusters
+  snrt_global_barrier();
+  attention(&bench);
+  bench_gemm(&bench, proj_l2, att_l2, wo_l2, S, D, D, TILE_N, sizeof(double), 0);
+  add_norm(&bench, y_l2, x_l2, proj_l2);
+  bench_gemm(&bench, h_l2, y_l2, w1_l2, S, F, D, TILE_N, sizeof(double), 1);
+  bench_gemm(&bench, z_l2, h_l2, w2_l2, S, D, F, TILE_N, sizeof(double), 0);
+  add_norm(&bench, out_l2, y_l2, z_l2);
+  bench_end(&bench, "transformer_block", flop, sizeof(double));
+
+  if (snrt_cluster_idx() == 0 && snrt_cluster_core_idx() == 0) n_errs += check();
+
+  return n_errs;
+}
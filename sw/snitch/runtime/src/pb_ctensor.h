@@ -0,0 +1,237 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Compressed tensor storage.
+//
+// Tensors (typically weights) are stored in L2 in a compressed format
+// produced offline by `sw/snitch/util/pack_ctensor.py`. The tensor is split
+// into blocks of `block_len` elements. Every stored block holds an FP32
+// scale followed by the encoded elements, padded to a multiple of 8 bytes:
+//
+//   - PB_CT_FP32: uncompressed FP32 elements, the scale is ignored
+//   - PB_CT_FP8:  FP8 (E4M3) elements, multiplied by the scale
+//   - PB_CT_INT4: signed INT4 elements, two per byte (low nibble first),
+//                 multiplied by the scale
+//
+// With the PB_CT_FLAG_SPARSE flag, blocks which are entirely zero are not
+// stored, and a bitmap with one bit per block (set for stored blocks)
+// follows the header.
+//
+// Clusters DMA the compressed blocks into TCDM and the compute cores
+// decompress them into FP32, see `pb_ct_decompress`.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PB_CT_MAGIC 0x54434250  // "PBCT"
+
+#define PB_CT_FLAG_SPARSE 0x1
+
+typedef enum {
+    PB_CT_FP32 = 0,
+    PB_CT_FP8 = 1,
+    PB_CT_INT4 = 2,
+} pb_ct_format_t;
+
+// Keep in sync with `sw/snitch/util/pack_ctensor.py`
+typedef struct {
+    uint32_t magic;
+    uint16_t format;
+    uint16_t flags;
+    // Number of elements, including the padding of the last block
+    uint32_t num_elems;
+    // Number of elements per block, a multiple of 16
+    uint32_t block_len;
+    uint32_t num_blocks;
+    uint32_t num_stored_blocks;
+    // Offsets from the start of the header, in bytes
+    uint32_t bitmap_offset;
+    uint32_t data_offset;
+} pb_ct_header_t;
+
+inline uint32_t pb_ct_payload_bytes(uint32_t format, uint32_t block_len) {
+    switch (format) {
+        case PB_CT_FP8:
+            return block_len;
+        case PB_CT_INT4:
+            return block_len / 2;
+        default:
+            return block_len * sizeof(float);
+    }
+}
+
+// Size of a stored block, including the scale and the padding
+inline uint32_t pb_ct_block_bytes(const pb_ct_header_t *hdr) {
+    uint32_t size =
+        sizeof(float) + pb_ct_payload_bytes(hdr->format, hdr->block_len);
+    return (size + 7) & ~7;
+}
+
+inline const uint8_t *pb_ct_data(const pb_ct_header_t *hdr) {
+    return (const uint8_t *)hdr + hdr->data_offset;
+}
+
+inline const uint32_t *pb_ct_bitmap(const pb_ct_header_t *hdr) {
+    return (const uint32_t *)((const uint8_t *)hdr + hdr->bitmap_offset);
+}
+
+inline uint32_t pb_ct_block_stored(const pb_ct_header_t *hdr, uint32_t block) {
+    if (!(hdr->flags & PB_CT_FLAG_SPARSE)) return 1;
+    return (pb_ct_bitmap(hdr)[block / 32] >> (block % 32)) & 1;
+}
+
+// Number of stored blocks among the blocks [first, first + n)
+inline uint32_t pb_ct_count_stored(const pb_ct_header_t *hdr, uint32_t first,
+                                   uint32_t n) {
+    if (!(hdr->flags & PB_CT_FLAG_SPARSE)) return n;
+    uint32_t count = 0;
+    for (uint32_t b = first; b < first + n; b++) {
+        count += pb_ct_block_stored(hdr, b);
+    }
+    return count;
+}
+
+/**
+ * @brief Initialize the FP8 (E4M3) decoding table.
+ *
+ * Decoding FP8 elements is a single lookup in this table. It should be
+ * placed in TCDM and initialized once, by a single core.
+ *
+ * @param lut  Table of 256 entries
+ */
+inline void pb_ct_fp8_lut_init(float *lut) {
+    for (uint32_t b = 0; b < 256; b++) {
+        uint32_t sign = b >> 7;
+        uint32_t exp = (b >> 3) & 0xF;
+        uint32_t man = b & 0x7;
+        union {
+            uint32_t u;
+            float f;
+        } val;
+        if (exp == 0xF && man == 0x7) {
+            val.u = 0x7FC00000;
+        } else if (exp == 0) {
+            // Subnormal, man * 2^-9
+            val.f = (float)man * (1.0f / 512.0f);
+        } else {
+            // Rebias the exponent from 7 to 127
+            val.u = ((exp + 120) << 23) | (man << 20);
+        }
+        val.u |= sign << 31;
+        lut[b] = val.f;
+    }
+}
+
+/**
+ * @brief Decode a single stored block into FP32 elements.
+ *
+ * @param dst        Destination of `block_len` elements
+ * @param blk        Stored block, starting with its scale
+ * @param format     Element format of the block
+ * @param block_len  Number of elements per block
+ * @param fp8_lut    FP8 decoding table, only used for PB_CT_FP8
+ */
+inline void pb_ct_decode_block(float *dst, const uint8_t *blk, uint32_t format,
+                               uint32_t block_len, const float *fp8_lut) {
+    float scale = *(const float *)blk;
+    const uint8_t *payload = blk + sizeof(float);
+    switch (format) {
+        case PB_CT_FP8:
+            for (uint32_t i = 0; i < block_len; i++) {
+                dst[i] = fp8_lut[payload[i]] * scale;
+            }
+            break;
+        case PB_CT_INT4:
+            for (uint32_t i = 0; i < block_len / 2; i++) {
+                // Sign-extend the nibbles by flipping and subtracting the
+                // sign bit
+                uint8_t b = payload[i];
+                int32_t lo = (int32_t)((b & 0xF) ^ 0x8) - 8;
+                int32_t hi = (int32_t)((b >> 4) ^ 0x8) - 8;
+                dst[2 * i] = (float)lo * scale;
+                dst[2 * i + 1] = (float)hi * scale;
+            }
+            break;
+        default:
+            for (uint32_t i = 0; i < block_len; i++) {
+                dst[i] = ((const float *)payload)[i];
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Decompress a tensor from L2 into TCDM.
+ *
+ * Must be called by all cores of the cluster. The tensor is processed in
+ * chunks of `chunk_blocks` blocks. The DM core fetches the stored blocks
+ * of the next chunk into one half of the staging buffer, while the
+ * compute cores decode the current chunk from the other half. Blocks
+ * which are not stored are zero-filled.
+ *
+ * @param dst           Destination of `hdr->num_elems` FP32 elements
+ * @param hdr           Compressed tensor in L2
+ * @param staging       TCDM buffer of `2 * chunk_blocks` stored blocks
+ * @param chunk_blocks  Number of blocks per chunk
+ * @param fp8_lut       Initialized FP8 decoding table, for PB_CT_FP8
+ */
+inline void pb_ct_decompress(float *dst, const pb_ct_header_t *hdr,
+                             uint8_t *staging, uint32_t chunk_blocks,
+                             const float *fp8_lut) {
+    uint32_t format = hdr->format;
+    uint32_t block_len = hdr->block_len;
+    uint32_t num_blocks = hdr->num_blocks;
+    uint32_t block_bytes = pb_ct_block_bytes(hdr);
+    uint32_t num_chunks = (num_blocks + chunk_blocks - 1) / chunk_blocks;
+    const uint8_t *data = pb_ct_data(hdr);
+
+    // Index of the first stored block of the chunk to fetch
+    uint32_t fetch_rank = 0;
+
+    for (uint32_t i = 0; i <= num_chunks; i++) {
+        // Fetch chunk i
+        if (snrt_is_dm_core() && i < num_chunks) {
+            uint32_t first = i * chunk_blocks;
+            uint32_t n = num_blocks - first < chunk_blocks ? num_blocks - first
+                                                           : chunk_blocks;
+            uint32_t stored = pb_ct_count_stored(hdr, first, n);
+            if (stored > 0) {
+                snrt_dma_start_1d(
+                    staging + (i % 2) * chunk_blocks * block_bytes,
+                    (void *)(data + fetch_rank * block_bytes),
+                    stored * block_bytes);
+                snrt_dma_wait_all();
+            }
+            fetch_rank += stored;
+        }
+
+        // Decode chunk i - 1
+        if (snrt_is_compute_core() && i > 0) {
+            uint32_t first = (i - 1) * chunk_blocks;
+            uint32_t n = num_blocks - first < chunk_blocks ? num_blocks - first
+                                                           : chunk_blocks;
+            const uint8_t *src =
+                staging + ((i - 1) % 2) * chunk_blocks * block_bytes;
+            uint32_t stored = 0;
+            for (uint32_t j = 0; j < n; j++) {
+                uint32_t present = pb_ct_block_stored(hdr, first + j);
+                if (j % snrt_cluster_compute_core_num() ==
+                    snrt_cluster_core_idx()) {
+                    float *out = dst + (first + j) * block_len;
+                    if (present) {
+                        pb_ct_decode_block(out, src + stored * block_bytes,
+                                           format, block_len, fp8_lut);
+                    } else {
+                        for (uint32_t k = 0; k < block_len; k++) out[k] = 0;
+                    }
+                }
+                stored += present;
+            }
+        }
+
+        snrt_cluster_hw_barrier();
+    }
+}
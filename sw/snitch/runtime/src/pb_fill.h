@@ -0,0 +1,159 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Bulk memory fill routines based on the cluster DMA.
+//
+// Zero fills are DMA copies out of the cluster zero memory, which reads
+// as zero over its whole window. Pattern fills first build a small seed
+// block in the destination, then let the DMA replicate it over the rest
+// of the buffer. All functions must be called from the DM core.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Size of the zero memory window, as configured by `zero_mem_size`
+// in `cfg/snitch_cluster.json`.
+#define PB_ZERO_MEM_SIZE (60 * 1024)
+
+// Size of the seed block written by the DM core for pattern fills.
+// Equals one beat of the 512-bit wide DMA data path.
+#define PB_FILL_SEED_SIZE 64
+
+// Size of the block replicated by the final 2D transfer of a pattern fill.
+#define PB_FILL_BLOCK_SIZE 1024
+
+inline void *pb_zero_mem_ptr() { return (void *)snrt_zero_memory_ptr(); }
+
+/**
+ * @brief Zero a memory region with the DMA.
+ *
+ * Issues one DMA transfer from the zero memory per `PB_ZERO_MEM_SIZE`
+ * chunk. Works for both TCDM and L2 destinations.
+ *
+ * @param dst   Start of the region to clear
+ * @param size  Size of the region in bytes
+ *
+ * @return ID of the last issued transfer. Use `snrt_dma_wait_all()`
+ *         to wait for completion.
+ */
+inline snrt_dma_txid_t pb_dma_zero(void *dst, size_t size) {
+    snrt_dma_txid_t txid = 0;
+    char *ptr = (char *)dst;
+    while (size > 0) {
+        size_t chunk = size < PB_ZERO_MEM_SIZE ? size : PB_ZERO_MEM_SIZE;
+        txid = snrt_dma_start_1d(ptr, pb_zero_mem_ptr(), chunk);
+        ptr += chunk;
+        size -= chunk;
+    }
+    return txid;
+}
+
+/**
+ * @brief Zero a memory region in several clusters at once.
+ *
+ * Same as `pb_dma_zero`, but every chunk is multicast to all clusters
+ * selected by `mask`.
+ *
+ * @param dst   Start of the region in one of the destination clusters
+ * @param size  Size of the region in bytes
+ * @param mask  Multicast mask selecting the destination clusters
+ *
+ * @return ID of the last issued transfer.
+ */
+inline snrt_dma_txid_t pb_dma_zero_mcast(void *dst, size_t size,
+                                         uint32_t mask) {
+    snrt_dma_txid_t txid = 0;
+    char *ptr = (char *)dst;
+    while (size > 0) {
+        size_t chunk = size < PB_ZERO_MEM_SIZE ? size : PB_ZERO_MEM_SIZE;
+        txid = snrt_dma_start_1d_mcast(ptr, pb_zero_mem_ptr(), chunk, mask);
+        ptr += chunk;
+        size -= chunk;
+    }
+    return txid;
+}
+
+/**
+ * @brief Replicate a block over a memory region.
+ *
+ * The first `block_size` bytes of `dst` must already hold the pattern.
+ * The DMA first doubles it up to `PB_FILL_BLOCK_SIZE` bytes, waiting for
+ * each step, and then replicates the resulting block over the remainder
+ * with a single 2D transfer with zero source stride.
+ *
+ * @param dst         Start of the region, holding the pattern
+ * @param block_size  Size of the pattern in bytes, nothing is done if zero
+ * @param size        Size of the region in bytes
+ */
+inline void pb_dma_replicate(void *dst, size_t block_size, size_t size) {
+    char *ptr = (char *)dst;
+    if (block_size == 0) return;
+
+    // Grow the block by doubling, as long as it fits
+    while ((2 * block_size <= PB_FILL_BLOCK_SIZE) && (2 * block_size <= size)) {
+        snrt_dma_start_1d(ptr + block_size, ptr, block_size);
+        snrt_dma_wait_all();
+        block_size *= 2;
+    }
+
+    // Replicate the block over all remaining full blocks
+    size_t repeat = size / block_size - 1;
+    if (repeat > 0) {
+        snrt_dma_start_2d(ptr + block_size, ptr, block_size, block_size, 0,
+                          repeat);
+    }
+
+    // Copy the remaining tail from the start of the block
+    size_t tail = size % block_size;
+    if (tail > 0) {
+        snrt_dma_start_1d(ptr + size - tail, ptr, tail);
+    }
+    snrt_dma_wait_all();
+}
+
+/**
+ * @brief Fill a memory region with a 32-bit value.
+ *
+ * The DM core writes a `PB_FILL_SEED_SIZE` byte seed to the start of the
+ * region, which is then replicated by the DMA. Regions smaller than the
+ * seed are filled by the core alone.
+ *
+ * @param dst    Start of the region, 4-byte aligned
+ * @param value  Value to replicate
+ * @param size   Size of the region in bytes, a multiple of 4
+ */
+inline void pb_dma_memset32(void *dst, uint32_t value, size_t size) {
+    volatile uint32_t *ptr = (volatile uint32_t *)dst;
+    size_t seed_size = size < PB_FILL_SEED_SIZE ? size : PB_FILL_SEED_SIZE;
+    for (size_t i = 0; i < seed_size / sizeof(uint32_t); i++) {
+        ptr[i] = value;
+    }
+    // Complete the seed stores before the DMA reads them back, which
+    // matters for destinations outside of the TCDM
+    asm volatile("fence" ::: "memory");
+    if (size > seed_size) pb_dma_replicate(dst, seed_size, size);
+}
+
+/**
+ * @brief Fill a memory region with an arbitrary pattern.
+ *
+ * The pattern is first copied to the start of the region with the DMA,
+ * and then replicated. The pattern must not overlap with the region. An
+ * empty pattern leaves the region untouched.
+ *
+ * @param dst           Start of the region
+ * @param pattern       Pattern to replicate
+ * @param pattern_size  Size of the pattern in bytes
+ * @param size          Size of the region in bytes
+ */
+inline void pb_dma_fill(void *dst, const void *pattern, size_t pattern_size,
+                        size_t size) {
+    if (pattern_size == 0) return;
+    size_t seed_size = size < pattern_size ? size : pattern_size;
+    snrt_dma_start_1d(dst, (void *)pattern, seed_size);
+    snrt_dma_wait_all();
+    if (size > seed_size) pb_dma_replicate(dst, seed_size, size);
+}
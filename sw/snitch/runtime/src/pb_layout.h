@@ -0,0 +1,244 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Layout-transforming DMA transfers.
+//
+// Each routine expresses a tensor layout change as a sequence of 2D DMA
+// transfers, so that data lands in TCDM in the layout expected by the
+// compute kernels, without any reshaping on the compute cores. Source and
+// destination can be anywhere in the system (typically L2 and TCDM).
+// All routines must be called from the DM core. They only issue the
+// transfers: use `snrt_dma_wait_all()` to wait for completion.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Transpose a row-major matrix.
+ *
+ * Computes `dst[c][r] = src[r][c]`. One 2D transfer is issued per row or
+ * column of the source, whichever is fewer, each moving one element per
+ * repetition.
+ *
+ * @param dst        Destination matrix of size `cols` x `rows`
+ * @param src        Source matrix of size `rows` x `cols`
+ * @param rows       Number of rows of the source matrix
+ * @param cols       Number of columns of the source matrix
+ * @param elem_size  Size of one element in bytes
+ *
+ * @return ID of the last issued transfer.
+ */
+inline snrt_dma_txid_t pb_dma_transpose(void *dst, void *src, uint32_t rows,
+                                        uint32_t cols, size_t elem_size) {
+    snrt_dma_txid_t txid = 0;
+    char *d = (char *)dst;
+    char *s = (char *)src;
+    if (rows <= cols) {
+        // Scatter every source row into a destination column
+        for (uint32_t r = 0; r < rows; r++) {
+            txid = snrt_dma_start_2d(d + r * elem_size, s + r * cols * elem_size,
+                                     elem_size, rows * elem_size, elem_size,
+                                     cols);
+        }
+    } else {
+        // Gather every destination row from a source column
+        for (uint32_t c = 0; c < cols; c++) {
+            txid = snrt_dma_start_2d(d + c * rows * elem_size, s + c * elem_size,
+                                     elem_size, elem_size, cols * elem_size,
+                                     rows);
+        }
+    }
+    return txid;
+}
+
+/**
+ * @brief Convert a tensor from NCHW to NHWC layout.
+ *
+ * Every image is a transpose of a `C` x `H*W` matrix.
+ */
+inline snrt_dma_txid_t pb_dma_nchw_to_nhwc(void *dst, void *src, uint32_t n,
+                                           uint32_t c, uint32_t h, uint32_t w,
+                                           size_t elem_size) {
+    snrt_dma_txid_t txid = 0;
+    size_t img_size = c * h * w * elem_size;
+    for (uint32_t i = 0; i < n; i++) {
+        txid = pb_dma_transpose((char *)dst + i * img_size,
+                                (char *)src + i * img_size, c, h * w,
+                                elem_size);
+    }
+    return txid;
+}
+
+/**
+ * @brief Convert a tensor from NHWC to NCHW layout.
+ *
+ * Every image is a transpose of a `H*W` x `C` matrix.
+ */
+inline snrt_dma_txid_t pb_dma_nhwc_to_nchw(void *dst, void *src, uint32_t n,
+                                           uint32_t c, uint32_t h, uint32_t w,
+                                           size_t elem_size) {
+    snrt_dma_txid_t txid = 0;
+    size_t img_size = c * h * w * elem_size;
+    for (uint32_t i = 0; i < n; i++) {
+        txid = pb_dma_transpose((char *)dst + i * img_size,
+                                (char *)src + i * img_size, h * w, c,
+                                elem_size);
+    }
+    return txid;
+}
+
+/**
+ * @brief Lower a CHW image to its im2col matrix.
+ *
+ * Produces a row-major matrix of `c * kh * kw` rows and `oh * ow` columns,
+ * where row `(ci * kh + ki) * kw + kj` holds, for every output pixel, the
+ * input element multiplied by kernel element `(ci, ki, kj)`. No padding is
+ * applied, i.e. `oh = (h - kh) / stride + 1` and `ow = (w - kw) / stride + 1`.
+ *
+ * With unit stride, every row of the result is a single 2D transfer.
+ * Otherwise, one 2D transfer per output row is needed.
+ *
+ * @param dst        Destination im2col matrix
+ * @param src        Source image in CHW layout
+ * @param c          Number of input channels
+ * @param h          Input height
+ * @param w          Input width
+ * @param kh         Kernel height
+ * @param kw         Kernel width
+ * @param stride     Convolution stride, in both dimensions
+ * @param elem_size  Size of one element in bytes
+ *
+ * @return ID of the last issued transfer.
+ */
+inline snrt_dma_txid_t pb_dma_im2col(void *dst, void *src, uint32_t c,
+                                     uint32_t h, uint32_t w, uint32_t kh,
+                                     uint32_t kw, uint32_t stride,
+                                     size_t elem_size) {
+    snrt_dma_txid_t txid = 0;
+    uint32_t oh = (h - kh) / stride + 1;
+    uint32_t ow = (w - kw) / stride + 1;
+    char *d = (char *)dst;
+    for (uint32_t ci = 0; ci < c; ci++) {
+        for (uint32_t ki = 0; ki < kh; ki++) {
+            for (uint32_t kj = 0; kj < kw; kj++) {
+                char *s = (char *)src + ((ci * h + ki) * w + kj) * elem_size;
+                if (stride == 1) {
+                    txid = snrt_dma_start_2d(d, s, ow * elem_size,
+                                             ow * elem_size, w * elem_size, oh);
+                } else {
+                    for (uint32_t y = 0; y < oh; y++) {
+                        txid = snrt_dma_start_2d(
+                            d + y * ow * elem_size,
+                            s + y * stride * w * elem_size, elem_size,
+                            elem_size, stride * elem_size, ow);
+                    }
+                }
+                d += oh * ow * elem_size;
+            }
+        }
+    }
+    return txid;
+}
+
+/**
+ * @brief Copy a tile out of a row-major matrix into a dense buffer.
+ *
+ * @param dst        Destination buffer of size `tile_rows` x `tile_cols`
+ * @param src        Top-left element of the tile in the source matrix
+ * @param tile_rows  Number of rows of the tile
+ * @param tile_cols  Number of columns of the tile
+ * @param ld         Leading dimension (number of columns) of the source
+ * @param elem_size  Size of one element in bytes
+ *
+ * @return ID of the issued transfer.
+ */
+inline snrt_dma_txid_t pb_dma_load_tile(void *dst, void *src,
+                                        uint32_t tile_rows, uint32_t tile_cols,
+                                        uint32_t ld, size_t elem_size) {
+    return snrt_dma_start_2d(dst, src, tile_cols * elem_size,
+                             tile_cols * elem_size, ld * elem_size, tile_rows);
+}
+
+/**
+ * @brief Copy a dense tile back into a row-major matrix.
+ *
+ * Inverse of `pb_dma_load_tile`.
+ */
+inline snrt_dma_txid_t pb_dma_store_tile(void *dst, void *src,
+                                         uint32_t tile_rows, uint32_t tile_cols,
+                                         uint32_t ld, size_t elem_size) {
+    return snrt_dma_start_2d(dst, src, tile_cols * elem_size, ld * elem_size,
+                             tile_cols * elem_size, tile_rows);
+}
+
+/**
+ * @brief Convert a row-major matrix to a blocked-tile layout.
+ *
+ * Tiles are stored contiguously in row-major tile order, and every tile
+ * is itself row-major. `rows` and `cols` must be multiples of the tile
+ * dimensions.
+ *
+ * @return ID of the last issued transfer.
+ */
+inline snrt_dma_txid_t pb_dma_to_tiled(void *dst, void *src, uint32_t rows,
+                                       uint32_t cols, uint32_t tile_rows,
+                                       uint32_t tile_cols, size_t elem_size) {
+    snrt_dma_txid_t txid = 0;
+    size_t tile_size = tile_rows * tile_cols * elem_size;
+    char *d = (char *)dst;
+    for (uint32_t i = 0; i < rows; i += tile_rows) {
+        for (uint32_t j = 0; j < cols; j += tile_cols) {
+            txid = pb_dma_load_tile(d, (char *)src + (i * cols + j) * elem_size,
+                                    tile_rows, tile_cols, cols, elem_size);
+            d += tile_size;
+        }
+    }
+    return txid;
+}
+
+/**
+ * @brief Copy a tile out of a row-major matrix into several clusters.
+ *
+ * Multicast variant of `pb_dma_load_tile`, issuing one multicast transfer
+ * per tile row.
+ *
+ * @param mask  Multicast mask selecting the destination clusters
+ */
+inline snrt_dma_txid_t pb_dma_load_tile_mcast(void *dst, void *src,
+                                              uint32_t tile_rows,
+                                              uint32_t tile_cols, uint32_t ld,
+                                              size_t elem_size, uint32_t mask) {
+    snrt_dma_txid_t txid = 0;
+    size_t row_size = tile_cols * elem_size;
+    for (uint32_t r = 0; r < tile_rows; r++) {
+        txid = snrt_dma_start_1d_mcast((char *)dst + r * row_size,
+                                       (char *)src + r * ld * elem_size,
+                                       row_size, mask);
+    }
+    return txid;
+}
+
+/**
+ * @brief Transpose a matrix into the TCDM of several clusters.
+ *
+ * The matrix is first transposed into a local TCDM buffer, and the result
+ * is then multicast to the clusters selected by `mask`. Element-wise
+ * multicast transfers would be far less efficient. Blocks until the local
+ * transpose is complete.
+ *
+ * @param dst        Destination matrix in one of the destination clusters
+ * @param local_dst  Staging buffer in the local TCDM, holding the result
+ * @param mask       Multicast mask selecting the destination clusters
+ */
+inline snrt_dma_txid_t pb_dma_transpose_mcast(void *dst, void *local_dst,
+                                              void *src, uint32_t rows,
+                                              uint32_t cols, size_t elem_size,
+                                              uint32_t mask) {
+    pb_dma_transpose(local_dst, src, rows, cols, elem_size);
+    snrt_dma_wait_all();
+    return snrt_dma_start_1d_mcast(dst, local_dst, rows * cols * elem_size,
+                                   mask);
+}
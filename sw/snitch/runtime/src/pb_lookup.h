@@ -0,0 +1,76 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Shared lookup region in the wide top SPM tile.
+//
+// The wide SPM tile serves both wide bursts and narrow accesses, so data
+// written once with the DMA can be read by any core with plain loads,
+// without a DMA round trip to its TCDM. This suits small, read-mostly data
+// shared by all clusters: constants, quantization tables, descriptors.
+// Wide bursts have priority on the SPM banks, so lookups may be delayed by
+// concurrent DMA traffic to the tile.
+//
+// The region is addressed by byte offsets. Its layout is up to the
+// application, e.g. fixed offsets agreed upon by all clusters.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PB_LOOKUP_SIZE sizeof(picobello_addrmap__top_spm_wide_t)
+
+// Pointer to a location of the lookup region
+inline volatile void *pb_lookup_ptr(uintptr_t offset) {
+    return (volatile void *)((uintptr_t)&picobello_addrmap.top_spm_wide +
+                             offset);
+}
+
+/**
+ * @brief Copy data into the lookup region with the DMA.
+ *
+ * Must be called by a DM core. Blocks until the transfer is complete, the
+ * data must be made visible to the readers by synchronizing with them
+ * afterwards, e.g. with a barrier.
+ *
+ * @param offset  Destination offset in the lookup region
+ * @param src     Source data
+ * @param size    Number of bytes to copy
+ */
+inline void pb_lookup_publish(uintptr_t offset, const void *src, size_t size) {
+    snrt_dma_start_1d((void *)pb_lookup_ptr(offset), (void *)src, size);
+    snrt_dma_wait_all();
+}
+
+// Load a 32-bit word from the lookup region
+inline uint32_t pb_lookup_load32(uintptr_t offset) {
+    return *(volatile uint32_t *)pb_lookup_ptr(offset);
+}
+
+// Load a 64-bit word from the lookup region, `offset` must be 8B-aligned
+inline uint64_t pb_lookup_load64(uintptr_t offset) {
+    return *(volatile uint64_t *)pb_lookup_ptr(offset);
+}
+
+// Store a 32-bit word to the lookup region, e.g. to update a descriptor
+inline void pb_lookup_store32(uintptr_t offset, uint32_t value) {
+    *(volatile uint32_t *)pb_lookup_ptr(offset) = value;
+}
+
+/**
+ * @brief Copy a small object, e.g. a descriptor, from the lookup region
+ *        with narrow loads.
+ *
+ * Both `offset` and `dst` must be 4B-aligned. Larger objects are moved
+ * more efficiently with the DMA.
+ *
+ * @param dst     Destination buffer
+ * @param offset  Source offset in the lookup region
+ * @param size    Number of bytes to copy, a multiple of 4
+ */
+inline void pb_lookup_read(void *dst, uintptr_t offset, size_t size) {
+    volatile uint32_t *src = (volatile uint32_t *)pb_lookup_ptr(offset);
+    uint32_t *d = (uint32_t *)dst;
+    for (size_t i = 0; i < size / sizeof(uint32_t); i++) d[i] = src[i];
+}
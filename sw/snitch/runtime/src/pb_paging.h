@@ -0,0 +1,248 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Cluster-driven staging of DRAM-resident data through L2.
+//
+// Builds on the L2 residency cache of `pb_page_cache.h`, which is shared
+// with the host. Pages are moved with the cluster DMA, so all functions
+// must be called by a DM core. Page streams prefetch a configurable number
+// of pages ahead of the page in use, overlapping the DRAM transfers with
+// the computation on the current page.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pb_page_cache.h"
+
+#define PB_PAGE_STREAM_MAX_DEPTH 8
+
+// Stream modes
+#define PB_PAGE_STREAM_READ 0
+// Pages are overwritten entirely, so they are not loaded from DRAM
+#define PB_PAGE_STREAM_WRITE 1
+// Pages are loaded and written back after being modified
+#define PB_PAGE_STREAM_UPDATE 2
+
+typedef struct {
+    pb_page_cache_t *cache;
+    uint64_t next_issue;
+    uint64_t next_use;
+    uint64_t end;
+    uint32_t depth;
+    uint32_t mode;
+    // Ring of pinned pages which have been issued but not returned yet
+    uint32_t head;
+    uint32_t count;
+    uint32_t frames[PB_PAGE_STREAM_MAX_DEPTH];
+    uint32_t loading[PB_PAGE_STREAM_MAX_DEPTH];
+    // Set for pages reserved by the stream. In write mode, they hold no data
+    // and stay in the LOADING state until they are released, so that other
+    // users of the page wait for the data written by the stream.
+    uint32_t fresh[PB_PAGE_STREAM_MAX_DEPTH];
+    snrt_dma_txid_t txids[PB_PAGE_STREAM_MAX_DEPTH];
+    // Frame returned by the last call to `pb_page_stream_next`, -1 if none
+    int32_t current;
+    uint32_t current_fresh;
+} pb_page_stream_t;
+
+// Write back the previous content of a frame, before it is reused
+inline void pb_page_dma_writeback(pb_page_cache_t *cache, pb_page_slot_t *slot) {
+    if (!slot->writeback) return;
+    snrt_dma_txid_t txid = snrt_dma_start_1d(
+        (void *)(uintptr_t)slot->writeback,
+        pb_page_frame_ptr(cache, slot->frame), cache->page_size);
+    snrt_dma_wait(txid);
+}
+
+/**
+ * @brief Pin the page containing `addr`, staging it with the DMA on a miss.
+ *
+ * Blocks until the page is resident. Retries while all frames are pinned.
+ *
+ * @param frame  Returns the frame index, to be passed to `pb_page_release`
+ *
+ * @return Pointer to `addr` in L2.
+ */
+inline void *pb_page_get(pb_page_cache_t *cache, uintptr_t addr,
+                         uint32_t *frame) {
+    pb_page_slot_t slot;
+    do {
+        slot = pb_page_reserve(cache, addr);
+    } while (slot.status == PB_PAGE_FULL || slot.status == PB_PAGE_BUSY);
+
+    void *ptr = pb_page_frame_ptr(cache, slot.frame);
+    if (slot.status == PB_PAGE_MISS) {
+        pb_page_dma_writeback(cache, &slot);
+        snrt_dma_txid_t txid = snrt_dma_start_1d(
+            ptr, (void *)(uintptr_t)pb_page_base(cache, addr),
+            cache->page_size);
+        snrt_dma_wait(txid);
+        pb_page_mark_valid(cache, slot.frame);
+    } else {
+        pb_page_wait(cache, slot.frame);
+    }
+    *frame = slot.frame;
+    return (uint8_t *)ptr + (addr - pb_page_base(cache, addr));
+}
+
+// Write back all unpinned dirty pages of the cache with the DMA
+inline void pb_page_flush(pb_page_cache_t *cache) {
+    for (uint32_t i = 0; i < cache->num_frames; i++) {
+        uint64_t tag = pb_page_reserve_writeback(cache, i);
+        if (!tag) continue;
+        snrt_dma_start_1d((void *)(uintptr_t)tag, pb_page_frame_ptr(cache, i),
+                          cache->page_size);
+        snrt_dma_wait_all();
+        pb_page_release(cache, i, 0);
+    }
+}
+
+/**
+ * @brief Initialize a stream over a DRAM region.
+ *
+ * @param base   DRAM address of the region
+ * @param size   Size of the region in bytes
+ * @param depth  Number of pages to prefetch ahead of the page in use,
+ *               between 1 and PB_PAGE_STREAM_MAX_DEPTH. The stream pins up to
+ *               `depth + 1` frames of the cache.
+ * @param mode   One of PB_PAGE_STREAM_READ, _WRITE or _UPDATE. In write
+ *               mode, `base` and `size` must be multiples of the page
+ *               size, since pages are written back entirely.
+ */
+inline void pb_page_stream_init(pb_page_stream_t *s, pb_page_cache_t *cache,
+                                uintptr_t base, size_t size, uint32_t depth,
+                                uint32_t mode) {
+    s->cache = cache;
+    s->next_issue = base;
+    s->next_use = base;
+    s->end = (uint64_t)base + size;
+    s->depth = depth;
+    s->mode = mode;
+    s->head = 0;
+    s->count = 0;
+    s->current = -1;
+    s->current_fresh = 0;
+}
+
+// Issue the transfers of the pages ahead, as long as frames are available.
+// Returns without blocking if the cache is full.
+inline void pb_page_stream_issue(pb_page_stream_t *s) {
+    pb_page_cache_t *cache = s->cache;
+    while (s->count < s->depth && s->next_issue < s->end) {
+        pb_page_slot_t slot = pb_page_reserve(cache, s->next_issue);
+        if (slot.status == PB_PAGE_FULL || slot.status == PB_PAGE_BUSY) return;
+
+        uint32_t idx = (s->head + s->count) % PB_PAGE_STREAM_MAX_DEPTH;
+        s->frames[idx] = slot.frame;
+        s->loading[idx] = (slot.status == PB_PAGE_MISS);
+        s->fresh[idx] = (slot.status == PB_PAGE_MISS);
+        if (slot.status == PB_PAGE_MISS) {
+            pb_page_dma_writeback(cache, &slot);
+            if (s->mode != PB_PAGE_STREAM_WRITE) {
+                s->txids[idx] = snrt_dma_start_1d(
+                    pb_page_frame_ptr(cache, slot.frame),
+                    (void *)(uintptr_t)pb_page_base(cache, s->next_issue),
+                    cache->page_size);
+            } else {
+                s->loading[idx] = 0;
+            }
+        }
+        s->count++;
+        s->next_issue = pb_page_base(cache, s->next_issue) + cache->page_size;
+    }
+}
+
+// Release the page returned by the last call to `pb_page_stream_next`
+inline void pb_page_stream_release(pb_page_stream_t *s) {
+    if (s->current < 0) return;
+    // Publish a page written by the stream, before it can be evicted
+    if (s->mode == PB_PAGE_STREAM_WRITE && s->current_fresh)
+        pb_page_mark_valid(s->cache, s->current);
+    pb_page_release(s->cache, s->current, s->mode != PB_PAGE_STREAM_READ);
+    s->current = -1;
+}
+
+/**
+ * @brief Return the next part of the region, staged in L2.
+ *
+ * Releases the part returned by the previous call, waits until the next
+ * page is resident and issues the prefetches of the following pages.
+ * Compute cores can work on the returned data once the DM core made it
+ * available to them, e.g. through a cluster barrier.
+ *
+ * @param len  Returns the number of bytes available at the returned
+ *             pointer, at most one page
+ *
+ * @return Pointer to the data in L2, NULL at the end of the region.
+ */
+inline void *pb_page_stream_next(pb_page_stream_t *s, size_t *len) {
+    pb_page_cache_t *cache = s->cache;
+    pb_page_stream_release(s);
+    if (s->next_use >= s->end) return NULL;
+
+    // Wait for a frame if no page could be issued yet
+    do {
+        pb_page_stream_issue(s);
+    } while (s->count == 0);
+
+    uint32_t idx = s->head;
+    uint32_t frame = s->frames[idx];
+    if (s->loading[idx]) {
+        snrt_dma_wait(s->txids[idx]);
+        pb_page_mark_valid(cache, frame);
+    } else if (s->mode != PB_PAGE_STREAM_WRITE || !s->fresh[idx]) {
+        pb_page_wait(cache, frame);
+    }
+    s->head = (s->head + 1) % PB_PAGE_STREAM_MAX_DEPTH;
+    s->count--;
+    s->current = frame;
+    s->current_fresh = s->fresh[idx];
+
+    uint64_t page = pb_page_base(cache, s->next_use);
+    uint64_t page_end = page + cache->page_size;
+    if (page_end > s->end) page_end = s->end;
+    *len = page_end - s->next_use;
+    void *ptr = (uint8_t *)pb_page_frame_ptr(cache, frame) + (s->next_use - page);
+    s->next_use = page_end;
+
+    // Refill the prefetch window
+    pb_page_stream_issue(s);
+    return ptr;
+}
+
+/**
+ * @brief Release all pages pinned by a stream.
+ *
+ * Pages which were prefetched but not used remain resident, except in
+ * write mode, where they hold no valid data. If other users are waiting
+ * for such a page, it is loaded from DRAM instead.
+ */
+inline void pb_page_stream_close(pb_page_stream_t *s) {
+    pb_page_stream_release(s);
+    while (s->count) {
+        uint32_t idx = s->head;
+        if (s->loading[idx]) {
+            snrt_dma_wait(s->txids[idx]);
+            pb_page_mark_valid(s->cache, s->frames[idx]);
+        }
+        if (s->mode == PB_PAGE_STREAM_WRITE && s->fresh[idx]) {
+            uint32_t frame = s->frames[idx];
+            uint64_t tag = s->cache->frames[frame].tag;
+            // The waiting users keep the frame pinned while it is loaded
+            if (!pb_page_discard(s->cache, frame)) {
+                snrt_dma_txid_t txid = snrt_dma_start_1d(
+                    pb_page_frame_ptr(s->cache, frame), (void *)(uintptr_t)tag,
+                    s->cache->page_size);
+                snrt_dma_wait(txid);
+                pb_page_mark_valid(s->cache, frame);
+            }
+        } else {
+            pb_page_release(s->cache, s->frames[idx], 0);
+        }
+        s->head = (s->head + 1) % PB_PAGE_STREAM_MAX_DEPTH;
+        s->count--;
+    }
+}
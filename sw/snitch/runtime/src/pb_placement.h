@@ -0,0 +1,119 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Topology-aware data placement.
+//
+// Helpers to place buffers in the L2 tiles closest to the clusters using
+// them, built on the mesh topology generated from the NoC configuration
+// (see `util/gen_topology.py`). All helpers taking indices only are
+// constant expressions in C++, so placement decisions on compile-time
+// constants are resolved at compile time. Since the topology tables have
+// internal linkage in C, all helpers are static.
+
+#pragma once
+
+#include <stdint.h>
+
+#include "pb_topology.h"
+
+/**
+ * @brief Select the L2 tile with the lowest total distance to a set of
+ *        clusters.
+ *
+ * Ties are broken by the lowest tile index.
+ *
+ * @param cluster_mask  Bit i is set if cluster i accesses the data
+ *
+ * @return Index of the selected L2 tile.
+ */
+PB_TOPO_FUNC uint32_t pb_place_l2_tile(uint32_t cluster_mask) {
+    uint32_t best_tile = 0;
+    uint32_t best_hops = UINT32_MAX;
+    for (uint32_t t = 0; t < PB_TOPO_NUM_L2_TILES; t++) {
+        uint32_t hops = 0;
+        for (uint32_t c = 0; c < PB_TOPO_NUM_CLUSTERS; c++) {
+            if (cluster_mask & (1u << c)) hops += pb_topo_cluster_l2_hops[c][t];
+        }
+        if (hops < best_hops) {
+            best_hops = hops;
+            best_tile = t;
+        }
+    }
+    return best_tile;
+}
+
+// Index of the cluster closest to an L2 tile, ties broken by lowest index
+PB_TOPO_FUNC uint32_t pb_place_nearest_cluster(uint32_t tile) {
+    uint32_t best = 0;
+    for (uint32_t c = 1; c < PB_TOPO_NUM_CLUSTERS; c++) {
+        if (pb_topo_cluster_l2_hops[c][tile] <
+            pb_topo_cluster_l2_hops[best][tile])
+            best = c;
+    }
+    return best;
+}
+
+// Mask of all clusters in the same mesh row (same Y index) as a cluster
+PB_TOPO_FUNC uint32_t pb_place_row_clusters(uint32_t cluster) {
+    uint32_t mask = 0;
+    for (uint32_t x = 0; x < PB_TOPO_CLUSTER_DIM_X; x++)
+        mask |= 1u << pb_topo_cluster_idx(x, pb_topo_cluster_y(cluster));
+    return mask;
+}
+
+// Mask of all clusters in the same mesh column (same X index) as a cluster
+PB_TOPO_FUNC uint32_t pb_place_col_clusters(uint32_t cluster) {
+    uint32_t mask = 0;
+    for (uint32_t y = 0; y < PB_TOPO_CLUSTER_DIM_Y; y++)
+        mask |= 1u << pb_topo_cluster_idx(pb_topo_cluster_x(cluster), y);
+    return mask;
+}
+
+// Base address of the L2 tile closest to a cluster
+PB_TOPO_FUNC uintptr_t pb_place_nearest_l2_addr(uint32_t cluster) {
+    return pb_topo_l2_tile_addr(pb_topo_cluster_nearest_l2[cluster]);
+}
+
+/**
+ * @brief Return a pointer at the given offset in the L2 tile closest to
+ *        the calling cluster.
+ *
+ * Buffers placed at the same offset in all tiles give every cluster a
+ * private copy at minimum distance, e.g. for replicated weights.
+ */
+static inline void *pb_place_local_l2_ptr(uintptr_t offset) {
+    return (void *)(pb_place_nearest_l2_addr(snrt_cluster_idx()) + offset);
+}
+
+/**
+ * @brief Return the multicast destination and mask reaching all clusters
+ *        in the row of the calling cluster.
+ *
+ * @param ptr   Buffer in the TCDM of the calling cluster
+ * @param mask  Returns the multicast mask to use with the destination
+ *
+ * @return Address of the buffer in the first cluster of the row.
+ */
+static inline void *pb_place_row_mcast_dst(void *ptr, uint32_t *mask) {
+    uint32_t cluster = snrt_cluster_idx();
+    *mask = PB_TOPO_MCAST_ROW_MASK;
+    return snrt_remote_l1_ptr(ptr, cluster,
+                              pb_topo_cluster_idx(0, pb_topo_cluster_y(cluster)));
+}
+
+/**
+ * @brief Return the multicast destination and mask reaching all clusters
+ *        in the column of the calling cluster.
+ *
+ * @param ptr   Buffer in the TCDM of the calling cluster
+ * @param mask  Returns the multicast mask to use with the destination
+ *
+ * @return Address of the buffer in the first cluster of the column.
+ */
+static inline void *pb_place_col_mcast_dst(void *ptr, uint32_t *mask) {
+    uint32_t cluster = snrt_cluster_idx();
+    *mask = PB_TOPO_MCAST_COL_MASK;
+    return snrt_remote_l1_ptr(ptr, cluster,
+                              pb_topo_cluster_idx(pb_topo_cluster_x(cluster), 0));
+}
@@ -0,0 +1,305 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Work-stealing task scheduler.
+//
+// Every compute core owns a task deque in TCDM. Cores push and pop tasks
+// at the bottom of their own deque, and steal from the top of the deques
+// of other cores when they run out of work: first within the cluster,
+// then, if enabled, in the other clusters through their TCDM. Every deque
+// is protected by a lock acquired with atomics, so remote steals only
+// need the atomics of the narrow interconnect.
+//
+// The DM core acts as a helper: tasks can request a DMA transfer of their
+// input data before they start, which the DM core issues in spawn order.
+//
+// Termination is detected through a counter of pending tasks, which must
+// be shared by all participating clusters. For cluster-local scheduling it
+// can live in TCDM, for cross-cluster scheduling it should live in L2.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PB_TASK_DEQUE_SIZE 32
+#define PB_TASK_PREFETCH_QUEUE_SIZE 32
+
+typedef void (*pb_task_fn_t)(void *arg, uint32_t idx);
+
+typedef struct {
+    pb_task_fn_t fn;
+    void *arg;
+    uint32_t idx;
+    // Set by the DM core once the input data of the task is available,
+    // NULL if the task does not request a prefetch
+    volatile uint32_t *ready;
+} pb_task_t;
+
+typedef struct {
+    volatile uint32_t lock;
+    // Index of the next task to steal
+    volatile uint32_t top;
+    // Index of the next free slot
+    volatile uint32_t bottom;
+    pb_task_t tasks[PB_TASK_DEQUE_SIZE];
+} pb_task_deque_t;
+
+typedef struct {
+    void *dst;
+    void *src;
+    size_t size;
+    volatile uint32_t *ready;
+} pb_task_prefetch_t;
+
+typedef struct {
+    volatile uint32_t lock;
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    pb_task_prefetch_t reqs[PB_TASK_PREFETCH_QUEUE_SIZE];
+} pb_task_prefetch_queue_t;
+
+typedef struct {
+    pb_task_deque_t deques[CFG_CLUSTER_NR_CORES - 1];
+    pb_task_prefetch_queue_t prefetch;
+    volatile uint32_t *pending;
+    // Clusters [first_cluster, first_cluster + num_clusters) steal from
+    // each other
+    uint32_t first_cluster;
+    uint32_t num_clusters;
+} pb_task_sched_t;
+
+/**
+ * @brief Allocate and initialize the scheduler of the cluster.
+ *
+ * Must be called by all cores of the cluster. For cross-cluster stealing,
+ * all participating clusters must call it at the same point of their L1
+ * allocation sequence, so that all schedulers live at the same offset,
+ * and must synchronize before spawning tasks.
+ *
+ * @param pending        Counter of pending tasks, initialized to zero
+ * @param first_cluster  First cluster participating in the stealing
+ * @param num_clusters   Number of participating clusters, 1 to only
+ *                       steal within the cluster
+ *
+ * @return Pointer to the scheduler of the calling cluster.
+ */
+inline pb_task_sched_t *pb_task_sched_init(volatile uint32_t *pending,
+                                           uint32_t first_cluster,
+                                           uint32_t num_clusters) {
+    pb_task_sched_t *sched = (pb_task_sched_t *)snrt_l1_alloc_cluster_local(
+        sizeof(pb_task_sched_t), sizeof(uint32_t));
+    if (snrt_is_dm_core()) {
+        for (uint32_t i = 0; i < snrt_cluster_compute_core_num(); i++) {
+            sched->deques[i].lock = 0;
+            sched->deques[i].top = 0;
+            sched->deques[i].bottom = 0;
+        }
+        sched->prefetch.lock = 0;
+        sched->prefetch.head = 0;
+        sched->prefetch.tail = 0;
+        sched->pending = pending;
+        sched->first_cluster = first_cluster;
+        sched->num_clusters = num_clusters;
+    }
+    snrt_cluster_hw_barrier();
+    return sched;
+}
+
+// Returns 1 if the task could be pushed, 0 if the deque is full
+inline uint32_t pb_task_push(pb_task_deque_t *dq, pb_task_t *task) {
+    uint32_t ok = 0;
+    snrt_mutex_acquire(&dq->lock);
+    if (dq->bottom - dq->top < PB_TASK_DEQUE_SIZE) {
+        dq->tasks[dq->bottom % PB_TASK_DEQUE_SIZE] = *task;
+        dq->bottom = dq->bottom + 1;
+        ok = 1;
+    }
+    snrt_mutex_release(&dq->lock);
+    return ok;
+}
+
+// Pop from the bottom of the deque, returns 0 if it is empty
+inline uint32_t pb_task_pop(pb_task_deque_t *dq, pb_task_t *task) {
+    uint32_t ok = 0;
+    snrt_mutex_acquire(&dq->lock);
+    if (dq->bottom != dq->top) {
+        dq->bottom = dq->bottom - 1;
+        *task = dq->tasks[dq->bottom % PB_TASK_DEQUE_SIZE];
+        ok = 1;
+    }
+    snrt_mutex_release(&dq->lock);
+    return ok;
+}
+
+// Steal from the top of the deque, returns 0 if it is empty
+inline uint32_t pb_task_steal(pb_task_deque_t *dq, pb_task_t *task) {
+    uint32_t ok = 0;
+    // Avoid taking the lock of empty deques, especially remote ones
+    if (dq->bottom == dq->top) return 0;
+    snrt_mutex_acquire(&dq->lock);
+    if (dq->bottom != dq->top) {
+        *task = dq->tasks[dq->top % PB_TASK_DEQUE_SIZE];
+        dq->top = dq->top + 1;
+        ok = 1;
+    }
+    snrt_mutex_release(&dq->lock);
+    return ok;
+}
+
+inline void pb_task_execute(pb_task_sched_t *sched, pb_task_t *task) {
+    if (task->ready) {
+        while (!*task->ready);
+    }
+    task->fn(task->arg, task->idx);
+    __atomic_sub_fetch(sched->pending, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Spawn a task on the deque of a compute core of the cluster.
+ *
+ * If the deque is full, the task is executed right away by the caller.
+ *
+ * @param core  Index of the compute core owning the deque
+ */
+inline void pb_task_spawn_on(pb_task_sched_t *sched, uint32_t core,
+                             pb_task_fn_t fn, void *arg, uint32_t idx) {
+    pb_task_t task = {fn, arg, idx, NULL};
+    __atomic_add_fetch(sched->pending, 1, __ATOMIC_RELAXED);
+    if (!pb_task_push(&sched->deques[core], &task)) {
+        pb_task_execute(sched, &task);
+    }
+}
+
+// Deque of the calling core. The DM core owns no deque and uses the one of
+// compute core 0.
+inline uint32_t pb_task_own_deque() {
+    return snrt_is_dm_core() ? 0 : snrt_cluster_core_idx();
+}
+
+/**
+ * @brief Spawn a task on the deque of the calling compute core.
+ *
+ * Tasks spawned by the DM core go to the deque of compute core 0.
+ */
+inline void pb_task_spawn(pb_task_sched_t *sched, pb_task_fn_t fn, void *arg,
+                          uint32_t idx) {
+    pb_task_spawn_on(sched, pb_task_own_deque(), fn, arg, idx);
+}
+
+/**
+ * @brief Spawn a task which needs data to be moved by the DMA first.
+ *
+ * The DM core of the cluster copies `size` bytes from `src` to `dst` and
+ * then sets `*ready`, which must be zero-initialized. The task does not
+ * start before. Blocks while the prefetch queue is full.
+ *
+ * The DM core only serves requests from within `pb_task_run`. Before
+ * that, the deque and the prefetch queue must not overflow, since the
+ * caller would wait for the DM core. If called by the DM core, the
+ * transfer is done right away and the task is spawned on the deque of
+ * compute core 0.
+ */
+inline void pb_task_spawn_prefetch(pb_task_sched_t *sched, pb_task_fn_t fn,
+                                   void *arg, uint32_t idx, void *dst,
+                                   void *src, size_t size,
+                                   volatile uint32_t *ready) {
+    if (snrt_is_dm_core()) {
+        snrt_dma_start_1d(dst, src, size);
+        snrt_dma_wait_all();
+        *ready = 1;
+        pb_task_spawn_on(sched, 0, fn, arg, idx);
+        return;
+    }
+
+    pb_task_prefetch_queue_t *q = &sched->prefetch;
+    uint32_t queued = 0;
+    while (!queued) {
+        snrt_mutex_acquire(&q->lock);
+        if (q->tail - q->head < PB_TASK_PREFETCH_QUEUE_SIZE) {
+            pb_task_prefetch_t *req =
+                &q->reqs[q->tail % PB_TASK_PREFETCH_QUEUE_SIZE];
+            req->dst = dst;
+            req->src = src;
+            req->size = size;
+            req->ready = ready;
+            q->tail = q->tail + 1;
+            queued = 1;
+        }
+        snrt_mutex_release(&q->lock);
+    }
+
+    pb_task_t task = {fn, arg, idx, ready};
+    __atomic_add_fetch(sched->pending, 1, __ATOMIC_RELAXED);
+    if (!pb_task_push(&sched->deques[snrt_cluster_core_idx()], &task)) {
+        pb_task_execute(sched, &task);
+    }
+}
+
+// Try to steal a task from any other core, local cores first
+inline uint32_t pb_task_find_work(pb_task_sched_t *sched, pb_task_t *task) {
+    uint32_t num_cores = snrt_cluster_compute_core_num();
+    uint32_t core = snrt_cluster_core_idx();
+    for (uint32_t i = 1; i < num_cores; i++) {
+        if (pb_task_steal(&sched->deques[(core + i) % num_cores], task))
+            return 1;
+    }
+
+    uint32_t cluster = snrt_cluster_idx();
+    for (uint32_t i = 1; i < sched->num_clusters; i++) {
+        uint32_t victim = sched->first_cluster +
+                          (cluster - sched->first_cluster + i) %
+                              sched->num_clusters;
+        pb_task_sched_t *remote =
+            (pb_task_sched_t *)snrt_remote_l1_ptr(sched, cluster, victim);
+        for (uint32_t j = 0; j < num_cores; j++) {
+            if (pb_task_steal(&remote->deques[(core + j) % num_cores], task))
+                return 1;
+        }
+    }
+    return 0;
+}
+
+// DM core loop serving the prefetch requests of the cluster
+inline void pb_task_prefetch_helper(pb_task_sched_t *sched) {
+    pb_task_prefetch_queue_t *q = &sched->prefetch;
+    while (*sched->pending || q->head != q->tail) {
+        if (q->head == q->tail) continue;
+        pb_task_prefetch_t *req = &q->reqs[q->head % PB_TASK_PREFETCH_QUEUE_SIZE];
+        snrt_dma_start_1d(req->dst, req->src, req->size);
+        snrt_dma_wait_all();
+        *req->ready = 1;
+        // Only the DM core consumes requests, but the lock orders the
+        // update with concurrent producers
+        snrt_mutex_acquire(&q->lock);
+        q->head = q->head + 1;
+        snrt_mutex_release(&q->lock);
+    }
+}
+
+/**
+ * @brief Execute tasks until all pending tasks are completed.
+ *
+ * Must be called by all cores of the cluster. Compute cores execute tasks
+ * from their own deque and steal from the others, the DM core serves the
+ * prefetch requests. Tasks can spawn further tasks. The initial tasks must
+ * be spawned before any core of any participating cluster calls this
+ * function, e.g. by synchronizing all clusters in between.
+ */
+inline void pb_task_run(pb_task_sched_t *sched) {
+    if (snrt_is_dm_core()) {
+        pb_task_prefetch_helper(sched);
+        return;
+    }
+
+    pb_task_deque_t *own = &sched->deques[snrt_cluster_core_idx()];
+    pb_task_t task;
+    while (1) {
+        if (pb_task_pop(own, &task) || pb_task_find_work(sched, &task)) {
+            pb_task_execute(sched, &task);
+        } else if (*sched->pending == 0) {
+            break;
+        }
+    }
+}
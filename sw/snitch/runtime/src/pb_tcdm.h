@@ -0,0 +1,249 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Bank-aware L1 allocation and TCDM conflict profiling.
+//
+// The TCDM is word-interleaved over its banks: consecutive 64-bit words
+// map to consecutive banks, and the mapping repeats every
+// PB_TCDM_BANK_PERIOD bytes. Streams which advance in lockstep with the
+// same stride, e.g. the SSR streams of a kernel or the compute cores of a
+// cluster working on the same buffer offsets, conflict on every access if
+// their buffers start on the same bank. The allocation helpers place
+// buffers at chosen bank offsets and pad row pitches, so that concurrent
+// streams land on disjoint banks.
+//
+// The profiler measures the TCDM congestion of a kernel with the cluster
+// performance counters, and estimates which of the buffers accessed by the
+// kernel collide, from their bank footprint.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef SNRT_TCDM_BANK_NUM
+#define PB_TCDM_NUM_BANKS SNRT_TCDM_BANK_NUM
+#else
+#define PB_TCDM_NUM_BANKS 32
+#endif
+#ifdef SNRT_TCDM_BANK_WIDTH
+#define PB_TCDM_BANK_WIDTH SNRT_TCDM_BANK_WIDTH
+#else
+#define PB_TCDM_BANK_WIDTH 8
+#endif
+#define PB_TCDM_BANK_PERIOD (PB_TCDM_NUM_BANKS * PB_TCDM_BANK_WIDTH)
+
+// Width of a DMA beat in TCDM, spanning several banks
+#define PB_TCDM_DMA_WIDTH 64
+
+// Maximum number of buffer accesses tracked by the profiler
+#define PB_TCDM_PROF_MAX_ACCESSES 16
+
+// Performance counters used by the profiler
+#define PB_TCDM_PROF_CNT_CYCLES 0
+#define PB_TCDM_PROF_CNT_ACCESSED 1
+#define PB_TCDM_PROF_CNT_CONGESTED 2
+
+// Bank holding the word at `ptr`
+inline uint32_t pb_tcdm_bank(const void *ptr) {
+    return ((uintptr_t)ptr / PB_TCDM_BANK_WIDTH) % PB_TCDM_NUM_BANKS;
+}
+
+/**
+ * @brief Allocate a cluster-local L1 buffer starting at a given bank.
+ *
+ * The buffer is carved out of an allocation aligned to the bank period, so
+ * up to PB_TCDM_BANK_PERIOD - PB_TCDM_BANK_WIDTH bytes are lost to the
+ * offset. As with `snrt_l1_alloc_cluster_local`, all cores must allocate
+ * in the same order.
+ *
+ * @param size  Size of the buffer in bytes
+ * @param bank  Bank of the first word of the buffer
+ */
+inline void *pb_l1_alloc_at_bank(size_t size, uint32_t bank) {
+    size_t offset = (bank % PB_TCDM_NUM_BANKS) * PB_TCDM_BANK_WIDTH;
+    char *ptr = (char *)snrt_l1_alloc_cluster_local(size + offset,
+                                                    PB_TCDM_BANK_PERIOD);
+    return ptr + offset;
+}
+
+/**
+ * @brief Allocate buffers which are accessed concurrently, with their start
+ *        banks evenly spread over the TCDM.
+ *
+ * Streams advancing in lockstep with the same stride over these buffers
+ * never access the same bank at the same time.
+ *
+ * @param ptrs   Returns the `n` buffers
+ * @param sizes  Sizes of the `n` buffers in bytes
+ * @param n      Number of buffers, between 1 and PB_TCDM_NUM_BANKS
+ */
+inline void pb_l1_alloc_skewed(void **ptrs, const size_t *sizes, uint32_t n) {
+    uint32_t skew = PB_TCDM_NUM_BANKS / n;
+    for (uint32_t i = 0; i < n; i++) {
+        ptrs[i] = pb_l1_alloc_at_bank(sizes[i], i * skew);
+    }
+}
+
+/**
+ * @brief Pad the pitch of a 2D buffer to avoid conflicts between rows.
+ *
+ * Returns the smallest pitch of at least `row_size` bytes spanning an odd
+ * number of bank words. Rows then start on distinct banks, and column
+ * accesses cycle through all banks instead of hitting a single one, e.g.
+ * when each core processes its own row of a matrix.
+ */
+inline size_t pb_tcdm_padded_pitch(size_t row_size) {
+    size_t words = (row_size + PB_TCDM_BANK_WIDTH - 1) / PB_TCDM_BANK_WIDTH;
+    if (words % 2 == 0) words++;
+    return words * PB_TCDM_BANK_WIDTH;
+}
+
+// Regular access pattern of a kernel to a TCDM buffer
+typedef struct {
+    const char *name;
+    uintptr_t base;
+    // Distance between consecutive accesses in bytes
+    uint32_t stride;
+    // Bytes per access, e.g. 8 for an SSR or PB_TCDM_DMA_WIDTH for the DMA
+    uint32_t width;
+    // Number of accesses
+    uint32_t count;
+} pb_tcdm_access_t;
+
+typedef struct {
+    uint32_t num_accesses;
+    pb_tcdm_access_t accesses[PB_TCDM_PROF_MAX_ACCESSES];
+    // Counter values of the last profiled region
+    uint32_t cycles;
+    uint32_t accessed;
+    uint32_t congested;
+} pb_tcdm_prof_t;
+
+inline void pb_tcdm_prof_init(pb_tcdm_prof_t *prof) {
+    prof->num_accesses = 0;
+    prof->cycles = 0;
+    prof->accessed = 0;
+    prof->congested = 0;
+}
+
+/**
+ * @brief Register an access pattern of the profiled kernel.
+ *
+ * Accesses registered on the same profiler are assumed to be concurrent.
+ *
+ * @return Zero on success, non-zero if the profiler is full.
+ */
+inline uint32_t pb_tcdm_prof_add(pb_tcdm_prof_t *prof, const char *name,
+                                 const void *base, uint32_t stride,
+                                 uint32_t width, uint32_t count) {
+    if (prof->num_accesses == PB_TCDM_PROF_MAX_ACCESSES) return 1;
+    pb_tcdm_access_t *acc = &prof->accesses[prof->num_accesses++];
+    acc->name = name;
+    acc->base = (uintptr_t)base;
+    acc->stride = stride;
+    acc->width = width;
+    acc->count = count;
+    return 0;
+}
+
+/**
+ * @brief Start measuring the TCDM congestion of the cluster.
+ *
+ * Must be called by a single core, before the cores executing the kernel
+ * are released, e.g. through a cluster barrier. The TCDM counters are
+ * shared by the whole cluster, so all traffic of the cluster is measured.
+ */
+inline void pb_tcdm_prof_start(pb_tcdm_prof_t *prof) {
+    (void)prof;
+    snrt_cfg_perf_counter(PB_TCDM_PROF_CNT_CYCLES, SNRT_PERF_CNT_CYCLES,
+                          snrt_hartid());
+    snrt_cfg_perf_counter(PB_TCDM_PROF_CNT_ACCESSED,
+                          SNRT_PERF_CNT_TCDM_ACCESSED, 0);
+    snrt_cfg_perf_counter(PB_TCDM_PROF_CNT_CONGESTED,
+                          SNRT_PERF_CNT_TCDM_CONGESTED, 0);
+    snrt_reset_perf_counter(PB_TCDM_PROF_CNT_CYCLES);
+    snrt_reset_perf_counter(PB_TCDM_PROF_CNT_ACCESSED);
+    snrt_reset_perf_counter(PB_TCDM_PROF_CNT_CONGESTED);
+    snrt_start_perf_counter(PB_TCDM_PROF_CNT_CYCLES);
+    snrt_start_perf_counter(PB_TCDM_PROF_CNT_ACCESSED);
+    snrt_start_perf_counter(PB_TCDM_PROF_CNT_CONGESTED);
+}
+
+// Stop the measurement, once all cores completed the kernel
+inline void pb_tcdm_prof_stop(pb_tcdm_prof_t *prof) {
+    snrt_stop_perf_counter(PB_TCDM_PROF_CNT_CYCLES);
+    snrt_stop_perf_counter(PB_TCDM_PROF_CNT_ACCESSED);
+    snrt_stop_perf_counter(PB_TCDM_PROF_CNT_CONGESTED);
+    prof->cycles = snrt_get_perf_counter(PB_TCDM_PROF_CNT_CYCLES);
+    prof->accessed = snrt_get_perf_counter(PB_TCDM_PROF_CNT_ACCESSED);
+    prof->congested = snrt_get_perf_counter(PB_TCDM_PROF_CNT_CONGESTED);
+}
+
+// Whether two accesses starting at `a` and `b` touch a common bank
+inline uint32_t pb_tcdm_overlap(uintptr_t a, uint32_t a_width, uintptr_t b,
+                                uint32_t b_width) {
+    uint32_t a_banks = (a % PB_TCDM_BANK_WIDTH + a_width +
+                        PB_TCDM_BANK_WIDTH - 1) / PB_TCDM_BANK_WIDTH;
+    uint32_t b_banks = (b % PB_TCDM_BANK_WIDTH + b_width +
+                        PB_TCDM_BANK_WIDTH - 1) / PB_TCDM_BANK_WIDTH;
+    if (a_banks >= PB_TCDM_NUM_BANKS || b_banks >= PB_TCDM_NUM_BANKS) return 1;
+    // Distance from the first bank of `a` to the first bank of `b`
+    uint32_t dist = (pb_tcdm_bank((void *)b) + PB_TCDM_NUM_BANKS -
+                     pb_tcdm_bank((void *)a)) % PB_TCDM_NUM_BANKS;
+    return dist < a_banks || PB_TCDM_NUM_BANKS - dist < b_banks;
+}
+
+/**
+ * @brief Estimate the conflicts between two concurrent accesses.
+ *
+ * Assumes that both accesses advance in lockstep, one element per step.
+ * The bank pattern of an access repeats at the latest after
+ * PB_TCDM_BANK_PERIOD steps, so at most as many steps are simulated.
+ *
+ * @param steps  Returns the number of simulated steps
+ *
+ * @return Number of steps in which both accesses touch a common bank.
+ */
+inline uint32_t pb_tcdm_collisions(const pb_tcdm_access_t *a,
+                                   const pb_tcdm_access_t *b,
+                                   uint32_t *steps) {
+    uint32_t n = a->count < b->count ? a->count : b->count;
+    if (n > PB_TCDM_BANK_PERIOD) n = PB_TCDM_BANK_PERIOD;
+    uint32_t collisions = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        collisions += pb_tcdm_overlap(a->base + i * a->stride, a->width,
+                                      b->base + i * b->stride, b->width);
+    }
+    *steps = n;
+    return collisions;
+}
+
+/**
+ * @brief Print the measured congestion and the colliding buffers.
+ *
+ * Lists every pair of registered accesses which collide in at least one
+ * step, with the fraction of colliding steps and their start banks.
+ *
+ * @return Number of colliding pairs.
+ */
+inline uint32_t pb_tcdm_prof_report(pb_tcdm_prof_t *prof, const char *kernel) {
+    uint32_t pairs = 0;
+    printf("[tcdm] %s: %u cycles, %u accesses, %u congested\n", kernel,
+           prof->cycles, prof->accessed, prof->congested);
+    for (uint32_t i = 0; i < prof->num_accesses; i++) {
+        for (uint32_t j = i + 1; j < prof->num_accesses; j++) {
+            pb_tcdm_access_t *a = &prof->accesses[i];
+            pb_tcdm_access_t *b = &prof->accesses[j];
+            uint32_t steps;
+            uint32_t collisions = pb_tcdm_collisions(a, b, &steps);
+            if (!collisions) continue;
+            pairs++;
+            printf("[tcdm]   %s (bank %u) <-> %s (bank %u): %u/%u steps\n",
+                   a->name, pb_tcdm_bank((void *)a->base), b->name,
+                   pb_tcdm_bank((void *)b->base), collisions, steps);
+        }
+    }
+    return pairs;
+}
@@ -41,7 +41,14 @@ typedef snitch_cluster__stride40000_t snitch_cluster_t;
 #include "eu.h"
 #include "kmp.h"
 #include "omp.h"
+#include "pb_ctensor.h"
+#include "pb_fill.h"
+#include "pb_layout.h"
+#include "pb_lookup.h"
 #include "pb_memory.h"
+#include "pb_paging.h"
+#include "pb_placement.h"
+#include "pb_task.h"
 #include "perf_cnt.h"
 #include "printf.h"
 #include "riscv.h"
@@ -50,3 +57,6 @@ typedef snitch_cluster__stride40000_t snitch_cluster_t;
 #include "sync.h"
 #include "team.h"
 #include "types.h"
+
+// Depends on perf_cnt.h and printf.h
+#include "pb_tcdm.h"
@@ -8,6 +8,7 @@
 // It will read the first uint32 data from each memory bank (both aligned and not).
 // The read will be performed only by cluster 0:
 // The narrow SPM will be accessed by core 0, while teh wide SPM by teh DMA core.
+// Core 1 concurrently accesses the wide SPM through its narrow port.
 
 #include <stdint.h>
 #include "pb_addrmap.h"
@@ -30,6 +31,7 @@
 #define SPM_BANKS_PER_WIDE_WORD (WIDE_WORD_WIDTH / SPM_SRAM_WIDE_DATA_WIDTH) // 4 banks per 512-bit word
 #define SPM_BANK_WIDE_ROWS (SPM_MEM_TILE_SIZE / (WIDE_WORD_WIDTH / 8)) / SPM_SRAM_WIDE_NUM_WORDS
 #define WIDE_TRANSFER_LENGTH 2 * (WIDE_WORD_WIDTH / 8) / sizeof(uint32_t) // Number of 32-bit words in a wide word
+#define WIDE_NARROW_TEST_WORD 6 // Bank word accessed through the narrow port
 
 // Array type definitions to map the SPM memory layout
 typedef uint32_t spm_mem_t[SPM_BANK_ROWS][SPM_SRAM_NUM_WORDS][SPM_BANKS_PER_WORD][SPM_SRAM_DATA_WIDTH / NARROW_WORD_SIZE];
@@ -90,9 +92,7 @@ uint32_t test_wide_spm (){
     snrt_dma_wait_all();
   }
 
-  // Since there is not narrow slave port on the wide SPM tile,
-  // read operations can be performed only using DMA transfer to local TCDM
-  // and then checking from there.
+  // Read back with DMA transfers to local TCDM and check from there.
   for (int i = 0; i < SPM_BANK_WIDE_ROWS; i++) {
     snrt_dma_start_1d(buf_res_al, (volatile void*) &(*spm_wide_mem)[i][0][0][0],  WIDE_TRANSFER_LENGTH * sizeof(uint32_t));
     snrt_dma_wait_all();
@@ -106,6 +106,33 @@ uint32_t test_wide_spm (){
   return ret_val;
 }
 
+// Test narrow accesses to the WIDE SPM Tile
+// Writes every 32-bit word of each physical bank, in a bank word outside of
+// the words 0 to 4 written concurrently by the DMA test, and reads them back
+// with narrow loads.
+uint32_t test_wide_spm_narrow (){
+  volatile spm_wide_mem_t *spm_wide_mem = (volatile spm_wide_mem_t *)&picobello_addrmap.top_spm_wide;
+  uint32_t words_per_bank = SPM_SRAM_WIDE_DATA_WIDTH / NARROW_WORD_SIZE;
+  uint32_t n_errors = SPM_BANK_WIDE_ROWS * SPM_BANKS_PER_WIDE_WORD * words_per_bank; // Total number of writes
+
+  for (uint32_t j = 0; j < SPM_BANK_WIDE_ROWS; j++) {
+    for (uint32_t k = 0; k < SPM_BANKS_PER_WIDE_WORD; k++) {
+      for (uint32_t l = 0; l < words_per_bank; l++) {
+        (*spm_wide_mem)[j][WIDE_NARROW_TEST_WORD][k][l] = j * k + l;
+      }
+    }
+  }
+
+  for (uint32_t j = 0; j < SPM_BANK_WIDE_ROWS; j++) {
+    for (uint32_t k = 0; k < SPM_BANKS_PER_WIDE_WORD; k++) {
+      for (uint32_t l = 0; l < words_per_bank; l++) {
+        n_errors -= ((*spm_wide_mem)[j][WIDE_NARROW_TEST_WORD][k][l] == j * k + l);
+      }
+    }
+  }
+  return n_errors;
+}
+
 
 int main() {
   uint32_t ret_val = 0;
@@ -115,6 +142,10 @@ int main() {
     if (snrt_cluster_core_idx() == 0) {
       ret_val |= test_narrow_spm();
     }
+    // Test Narrow port of the Wide SPM: Core 1
+    else if (snrt_cluster_core_idx() == 1) {
+      ret_val |= test_wide_spm_narrow();
+    }
     // Test Wide SPM: DMA Core
     else if (snrt_is_dm_core()) {
       ret_val = test_wide_spm();
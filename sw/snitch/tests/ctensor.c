@@ -0,0 +1,125 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the decompression of compressed tensors stored in L2.
+// The following routine is implemented by cluster 0:
+//   - The DM core builds a block-sparse INT4 tensor in L2, in the format
+//     produced by `sw/snitch/util/pack_ctensor.py`
+//   - All cores decompress it into TCDM, and the DM core checks the result
+//   - All cores decompress a block-sparse FP8 and a dense FP32 tensor,
+//     generated by `pack_ctensor.py` (see `data/gen_ctensor.py`), and the
+//     DM core checks them against the elements decoded by the packer
+//   - Core 0 checks the FP8 decoding table against known encodings
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+#include "data/ctensor_fp32.h"
+#include "data/ctensor_fp8.h"
+
+/* Parameters */
+#define BLOCK_LEN 16
+#define NUM_BLOCKS 8
+#define CHUNK_BLOCKS 3  // Not a divisor of NUM_BLOCKS to test the last chunk
+#define SCALE 0.5f
+
+#define BITMAP_OFFSET sizeof(pb_ct_header_t)
+#define DATA_OFFSET 64
+#define BLOCK_BYTES 16  // 4B scale + 8B payload, padded to 8B
+#define MAX_BLOCK_BYTES 72  // FP32 blocks: 4B scale + 64B payload, padded to 8B
+
+uint8_t l2_ctensor[DATA_OFFSET + NUM_BLOCKS * BLOCK_BYTES] __attribute__((aligned(64)));
+
+// Known E4M3 encodings
+#define NUM_FP8_CHECKS 6
+static const uint8_t fp8_enc[NUM_FP8_CHECKS] = {0x00, 0x38, 0xB8, 0x40, 0x3C, 0x7E};
+static const float fp8_val[NUM_FP8_CHECKS] = {0.0f, 1.0f, -1.0f, 2.0f, 1.5f, 448.0f};
+
+/* Helper functions */
+// Only even blocks are stored, odd blocks are all zeros
+static inline uint32_t block_stored(uint32_t b) { return (b % 2) == 0; }
+
+static inline int32_t quantized_value(uint32_t b, uint32_t i) {
+  return (int32_t)((i + b) % 16) - 8;
+}
+
+void build_ctensor() {
+  pb_ct_header_t *hdr = (pb_ct_header_t *)l2_ctensor;
+  hdr->magic             = PB_CT_MAGIC;
+  hdr->format            = PB_CT_INT4;
+  hdr->flags             = PB_CT_FLAG_SPARSE;
+  hdr->num_elems         = NUM_BLOCKS * BLOCK_LEN;
+  hdr->block_len         = BLOCK_LEN;
+  hdr->num_blocks        = NUM_BLOCKS;
+  hdr->num_stored_blocks = NUM_BLOCKS / 2;
+  hdr->bitmap_offset     = BITMAP_OFFSET;
+  hdr->data_offset       = DATA_OFFSET;
+
+  uint32_t bitmap = 0;
+  uint8_t *blk = l2_ctensor + DATA_OFFSET;
+  for (uint32_t b = 0; b < NUM_BLOCKS; b++) {
+    if (!block_stored(b)) continue;
+    bitmap |= 1 << b;
+    *(float *)blk = SCALE;
+    for (uint32_t i = 0; i < BLOCK_LEN / 2; i++) {
+      uint8_t lo = quantized_value(b, 2 * i) & 0xF;
+      uint8_t hi = quantized_value(b, 2 * i + 1) & 0xF;
+      blk[sizeof(float) + i] = lo | (hi << 4);
+    }
+    blk += BLOCK_BYTES;
+  }
+  *(uint32_t *)(l2_ctensor + BITMAP_OFFSET) = bitmap;
+}
+
+uint32_t check_result(volatile float *buf) {
+  uint32_t n_errs = 0;
+  for (uint32_t b = 0; b < NUM_BLOCKS; b++) {
+    for (uint32_t i = 0; i < BLOCK_LEN; i++) {
+      float expected = block_stored(b) ? quantized_value(b, i) * SCALE : 0.0f;
+      n_errs += (buf[b * BLOCK_LEN + i] != expected);
+    }
+  }
+  return n_errs;
+}
+
+uint32_t check_packed(volatile float *buf, const float *ref, uint32_t num_elems) {
+  uint32_t n_errs = 0;
+  for (uint32_t i = 0; i < num_elems; i++) n_errs += (buf[i] != ref[i]);
+  return n_errs;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+
+  if (snrt_cluster_idx() != 0) return 0;
+
+  float *buf_dst     = (float *)snrt_l1_alloc_cluster_local(NUM_BLOCKS * BLOCK_LEN * sizeof(float), sizeof(float));
+  float *buf_fp8     = (float *)snrt_l1_alloc_cluster_local(sizeof(ctensor_fp8_ref), sizeof(float));
+  float *buf_fp32    = (float *)snrt_l1_alloc_cluster_local(sizeof(ctensor_fp32_ref), sizeof(float));
+  uint8_t *staging   = (uint8_t *)snrt_l1_alloc_cluster_local(2 * CHUNK_BLOCKS * MAX_BLOCK_BYTES, 64);
+  float *fp8_lut     = (float *)snrt_l1_alloc_cluster_local(256 * sizeof(float), sizeof(float));
+
+  if (snrt_is_dm_core()) build_ctensor();
+  if (snrt_cluster_core_idx() == 0) pb_ct_fp8_lut_init(fp8_lut);
+  snrt_cluster_hw_barrier();
+
+  pb_ct_decompress(buf_dst, (const pb_ct_header_t *)l2_ctensor, staging, CHUNK_BLOCKS, fp8_lut);
+  pb_ct_decompress(buf_fp8, (const pb_ct_header_t *)ctensor_fp8, staging, CHUNK_BLOCKS, fp8_lut);
+  pb_ct_decompress(buf_fp32, (const pb_ct_header_t *)ctensor_fp32, staging, CHUNK_BLOCKS, fp8_lut);
+
+  if (snrt_is_dm_core()) {
+    n_errs += check_result(buf_dst);
+    n_errs += check_packed(buf_fp8, ctensor_fp8_ref, sizeof(ctensor_fp8_ref) / sizeof(float));
+    n_errs += check_packed(buf_fp32, ctensor_fp32_ref, sizeof(ctensor_fp32_ref) / sizeof(float));
+  }
+
+  if (snrt_cluster_core_idx() == 0) {
+    for (uint32_t i = 0; i < NUM_FP8_CHECKS; i++) {
+      n_errs += (fp8_lut[fp8_enc[i]] != fp8_val[i]);
+    }
+  }
+
+  return n_errs;
+}
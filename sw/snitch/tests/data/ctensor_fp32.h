@@ -0,0 +1,42 @@
+// Generated by pack_ctensor.py, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t ctensor_fp32[280] __attribute__((aligned(64))) = {
+    0x50, 0x42, 0x43, 0x54, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x1c, 0x45, 0x04, 0xc3, 0x0a, 0x73, 0xc7, 0xc2, 0xe1, 0xe8, 0x1f, 0x42,
+    0x87, 0x18, 0xb5, 0xc2, 0xd8, 0x43, 0x17, 0xc2, 0x3f, 0xec, 0x01, 0x43, 0x6e, 0x81, 0x0e, 0xc2,
+    0xcc, 0x80, 0x93, 0x42, 0x3a, 0xb9, 0xba, 0xc2, 0x9d, 0x59, 0xa4, 0xc1, 0x21, 0x01, 0xbe, 0xc2,
+    0xfd, 0x9c, 0x07, 0xc2, 0xc7, 0x0f, 0xa8, 0x42, 0x67, 0xbb, 0x2c, 0xc3, 0xfb, 0xc4, 0x2d, 0x42,
+    0x40, 0x30, 0xbe, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0xf5, 0xa8, 0x6d, 0xc2,
+    0x15, 0x9b, 0x10, 0xc3, 0x7e, 0xd0, 0xe6, 0x40, 0x0e, 0xcc, 0x53, 0xc2, 0x17, 0x24, 0xba, 0x41,
+    0x8e, 0xda, 0x0b, 0x40, 0x8a, 0x2d, 0x20, 0x43, 0x08, 0x7c, 0xbf, 0xc1, 0x12, 0xb3, 0xcc, 0xc2,
+    0xa6, 0x6b, 0x8f, 0x41, 0x52, 0xff, 0xaf, 0x41, 0x34, 0xeb, 0x07, 0x43, 0xb2, 0x05, 0xa7, 0x42,
+    0x99, 0xbf, 0x0e, 0x42, 0x8e, 0x54, 0x12, 0x43, 0xab, 0xc0, 0xed, 0xc2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3f, 0x8f, 0xe6, 0x7f, 0xc2, 0xb0, 0x50, 0xb9, 0xc2, 0x86, 0xec, 0x1b, 0xc2,
+    0x2a, 0xab, 0x09, 0xc3, 0x75, 0x0f, 0x7e, 0x42, 0x35, 0xc7, 0xb1, 0xc1, 0xa4, 0x14, 0x13, 0xc3,
+    0xa6, 0x1d, 0xcb, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Decompressed elements, to check the runtime against
+const float ctensor_fp32_ref[48] = {
+    -1.32269958e+02f, -9.97246857e+01f, 3.99774208e+01f, -9.05479050e+01f,
+    -3.78162537e+01f, 1.29922836e+02f, -3.56263962e+01f, 7.37515564e+01f,
+    -9.33617706e+01f, -2.05437565e+01f, -9.50022049e+01f, -3.39033089e+01f,
+    8.40308151e+01f, -1.72732040e+02f, 4.34423637e+01f, 2.37735596e+01f,
+    -5.94149971e+01f, -1.44605789e+02f, 7.21295071e+00f, -5.29492722e+01f,
+    2.32676220e+01f, 2.18521452e+00f, 1.60177887e+02f, -2.39355621e+01f,
+    -1.02349747e+02f, 1.79275627e+01f, 2.19996681e+01f, 1.35918762e+02f,
+    8.35111237e+01f, 3.56871071e+01f, 1.46330292e+02f, -1.18876305e+02f,
+    -6.39751549e+01f, -9.26575928e+01f, -3.89809799e+01f, -1.37668610e+02f,
+    6.35150948e+01f, -2.22222691e+01f, -1.47080627e+02f, -1.01557907e+02f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+};
@@ -0,0 +1,46 @@
+// Generated by pack_ctensor.py, do not edit.
+
+#pragma once
+
+#include <stdint.h>
+
+const uint8_t ctensor_fp8[160] __attribute__((aligned(64))) = {
+    0x50, 0x42, 0x43, 0x54, 0x01, 0x00, 0x01, 0x00, 0x60, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+    0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x13, 0x21, 0x92, 0x36, 0x69, 0xf7, 0x73, 0x75, 0xfe, 0xf9, 0x5f, 0xe9, 0xc7, 0xf4, 0x75, 0x73,
+    0x57, 0x78, 0x6d, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x1f, 0x84, 0x39, 0xf5, 0xfa, 0x77, 0x7e,
+    0xe3, 0xfa, 0xfa, 0x78, 0x79, 0x75, 0xf8, 0x6c, 0x64, 0x6b, 0x7b, 0x6b, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x2e, 0x76, 0x3b, 0x73, 0x59, 0x6a, 0x73, 0xfc, 0xeb, 0xf0, 0xf3, 0xe9, 0x7c, 0xf6, 0x78,
+    0xfe, 0xeb, 0x63, 0x72, 0x00, 0x00, 0x00, 0x00, 0x96, 0xd6, 0xc0, 0x3e, 0x6f, 0xf3, 0xec, 0xed,
+    0xfa, 0x70, 0xf0, 0x45, 0x70, 0x6f, 0x73, 0xdd, 0xee, 0xdb, 0xfe, 0xfc, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Decompressed elements, to check the runtime against
+const float ctensor_fp8_ref[96] = {
+    3.13559227e-04f, -1.04519748e-03f, 7.66478130e-04f, 9.05837805e-04f,
+    -1.95103523e-03f, -1.25423691e-03f, 1.30649685e-04f, -3.13559227e-04f,
+    -1.63312106e-05f, -8.36157938e-04f, 9.05837805e-04f, 7.66478130e-04f,
+    6.53248426e-05f, 1.11487729e-03f, 4.52918903e-04f, -8.36157938e-04f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    -5.24165742e-02f, -8.06408823e-02f, 6.04806617e-02f, 1.12897240e-01f,
+    -1.10881217e-02f, -8.06408823e-02f, -8.06408823e-02f, 6.45127073e-02f,
+    7.25767985e-02f, 5.24165742e-02f, -6.45127073e-02f, 2.41922662e-02f,
+    1.20961331e-02f, 2.21762434e-02f, 8.87049735e-02f, 2.21762434e-02f,
+    6.61127448e-01f, 6.76153004e-02f, 3.00512463e-01f, 6.61127448e-01f,
+    -1.44245982e+00f, -3.30563724e-01f, -4.80819941e-01f, -6.61127448e-01f,
+    -2.70461202e-01f, 1.44245982e+00f, -8.41434896e-01f, 9.61639881e-01f,
+    -1.68286979e+00f, -3.30563724e-01f, 1.65281862e-01f, 6.01024926e-01f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f, 0.00000000e+00f,
+    4.51964607e+01f, -6.62881393e+01f, -3.61571655e+01f, -3.91702652e+01f,
+    -1.20523895e+02f, 4.82095566e+01f, -4.82095566e+01f, 1.22407079e+00f,
+    4.82095566e+01f, 4.51964607e+01f, 6.62881393e+01f, -9.79256630e+00f,
+    -4.21833611e+01f, -8.28601742e+00f, -1.68733444e+02f, -1.44628662e+02f,
+};
@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate the compressed tensors of the `ctensor.c` test with the offline
+# packer, together with their decompressed elements.
+
+import os
+import sys
+
+import numpy as np
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, '../../util'))
+
+from pack_ctensor import pack, emit_c_header  # noqa: E402
+
+BLOCK_LEN = 16
+
+
+def main():
+    rng = np.random.default_rng(42)
+
+    # Block-sparse FP8 tensor, with a different dynamic range in every block
+    fp8 = rng.standard_normal((6, BLOCK_LEN)) * np.logspace(-3, 2, 6)[:, None]
+    fp8[[1, 4]] = 0
+
+    # Dense FP32 tensor, whose last block is padded
+    fp32 = rng.standard_normal(2 * BLOCK_LEN + 8) * 100
+
+    for name, tensor, fmt, sparse in [('ctensor_fp8', fp8, 'fp8', True),
+                                      ('ctensor_fp32', fp32, 'fp32', False)]:
+        image = pack(tensor, fmt, BLOCK_LEN, sparse)
+        with open(os.path.join(HERE, f'{name}.h'), 'w') as f:
+            f.write(emit_c_header(image, name, ref=True))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,88 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the DMA-based fill routines of the Picobello runtime.
+// The following routine is implemented:
+//   - Every cluster fills a TCDM buffer with a value, then zeroes it
+//   - Every cluster fills a TCDM buffer with a multi-word pattern
+//   - Cluster 0 fills and zeroes a buffer in L2
+//   - Cluster 0 zeroes a TCDM buffer in all other clusters with a single multicast
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define LENGTH 1000  // Not a multiple of the fill block size to test tails
+#define L2_LENGTH 4096
+#define INITIALIZER 0xAAAAAAAA
+#define PATTERN_LENGTH 3
+
+#define BCAST_MASK_ALL ((snrt_cluster_num() - 1) << 18)
+
+uint32_t l2_buf[L2_LENGTH];
+
+static const uint32_t pattern[PATTERN_LENGTH] = {0x11111111, 0x22222222, 0x33333333};
+
+/* Helper functions */
+uint32_t check_value(volatile uint32_t *buf, uint32_t value, uint32_t length) {
+  uint32_t n_errs = 0;
+  for (uint32_t i = 0; i < length; i++) {
+    n_errs += (buf[i] != value);
+  }
+  return n_errs;
+}
+
+uint32_t check_pattern(volatile uint32_t *buf, uint32_t length) {
+  uint32_t n_errs = 0;
+  for (uint32_t i = 0; i < length; i++) {
+    n_errs += (buf[i] != pattern[i % PATTERN_LENGTH]);
+  }
+  return n_errs;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+
+  snrt_global_barrier();
+
+  if (snrt_is_dm_core()) {
+    uint32_t *buf       = (uint32_t *)snrt_l1_alloc_cluster_local(LENGTH * sizeof(uint32_t), sizeof(uint32_t));
+    uint32_t *buf_mcast = (uint32_t *)snrt_l1_alloc_cluster_local(LENGTH * sizeof(uint32_t), sizeof(uint32_t));
+
+    // Value and zero fill in the local TCDM
+    pb_dma_memset32(buf, INITIALIZER, LENGTH * sizeof(uint32_t));
+    n_errs += check_value(buf, INITIALIZER, LENGTH);
+    pb_dma_zero(buf, LENGTH * sizeof(uint32_t));
+    snrt_dma_wait_all();
+    n_errs += check_value(buf, 0, LENGTH);
+
+    // Pattern fill in the local TCDM
+    pb_dma_fill(buf, pattern, sizeof(pattern), LENGTH * sizeof(uint32_t));
+    n_errs += check_pattern(buf, LENGTH);
+
+    // Value and zero fill in L2
+    if (snrt_cluster_idx() == 0) {
+      pb_dma_memset32(l2_buf, INITIALIZER, L2_LENGTH * sizeof(uint32_t));
+      n_errs += check_value(l2_buf, INITIALIZER, L2_LENGTH);
+      pb_dma_zero(l2_buf, L2_LENGTH * sizeof(uint32_t));
+      snrt_dma_wait_all();
+      n_errs += check_value(l2_buf, 0, L2_LENGTH);
+    }
+
+    // Multicast zero fill
+    pb_dma_memset32(buf_mcast, INITIALIZER, LENGTH * sizeof(uint32_t));
+    snrt_inter_cluster_barrier();
+    if (snrt_cluster_idx() == 0) {
+      pb_dma_zero_mcast(snrt_remote_l1_ptr(buf_mcast, 0, 1), LENGTH * sizeof(uint32_t), BCAST_MASK_ALL);
+      snrt_dma_wait_all();
+    }
+    snrt_inter_cluster_barrier();
+    // As in the other multicast tests, only the receiving clusters check
+    if (snrt_cluster_idx() != 0) n_errs += check_value(buf_mcast, 0, LENGTH);
+  }
+
+  return n_errs;
+}
@@ -0,0 +1,190 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the layout-transforming DMA transfers of the Picobello
+// runtime, and compares them with reshaping on the compute cores.
+// The following routine is implemented by cluster 0:
+//   - Transpose an L2 matrix into TCDM with the DMA
+//   - Transpose the same matrix by copying it to TCDM and letting the
+//     compute cores reshape it
+//   - Lower a CHW image to its im2col matrix, with unit and non-unit stride
+//   - Convert a matrix to a blocked-tile layout
+// Cluster 0 then multicasts a tile of the matrix and its transpose to all
+// other clusters, which check them.
+// The cycles spent by both transpose variants are stored in `cycles`,
+// and can be inspected in the L2 memory dump.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define ROWS 16
+#define COLS 24
+#define TILE_ROWS 4
+#define TILE_COLS 8
+
+#define IMG_C 2
+#define IMG_H 6
+#define IMG_W 6
+#define KERNEL 3
+
+// Origin of the multicast tile in the matrix
+#define MCAST_TILE_ROW 4
+#define MCAST_TILE_COL 8
+
+#define BCAST_MASK_ALL ((snrt_cluster_num() - 1) << 18)
+
+uint32_t l2_mat[ROWS * COLS];
+uint32_t l2_img[IMG_C * IMG_H * IMG_W];
+
+// Cycles spent by the DMA and the core-side transpose, respectively
+volatile uint32_t cycles[2];
+
+/* Helper functions */
+uint32_t check_transpose(volatile uint32_t *buf) {
+  uint32_t n_errs = 0;
+  for (uint32_t c = 0; c < COLS; c++) {
+    for (uint32_t r = 0; r < ROWS; r++) {
+      n_errs += (buf[c * ROWS + r] != r * COLS + c);
+    }
+  }
+  return n_errs;
+}
+
+uint32_t check_im2col(volatile uint32_t *buf, uint32_t stride) {
+  uint32_t n_errs = 0;
+  uint32_t oh = (IMG_H - KERNEL) / stride + 1;
+  uint32_t ow = (IMG_W - KERNEL) / stride + 1;
+  for (uint32_t c = 0; c < IMG_C; c++) {
+    for (uint32_t ki = 0; ki < KERNEL; ki++) {
+      for (uint32_t kj = 0; kj < KERNEL; kj++) {
+        for (uint32_t y = 0; y < oh; y++) {
+          for (uint32_t x = 0; x < ow; x++) {
+            uint32_t row = (c * KERNEL + ki) * KERNEL + kj;
+            uint32_t expected = (c * IMG_H + y * stride + ki) * IMG_W + x * stride + kj;
+            n_errs += (buf[(row * oh + y) * ow + x] != expected);
+          }
+        }
+      }
+    }
+  }
+  return n_errs;
+}
+
+uint32_t check_tiled(volatile uint32_t *buf) {
+  uint32_t n_errs = 0;
+  uint32_t idx = 0;
+  for (uint32_t i = 0; i < ROWS; i += TILE_ROWS) {
+    for (uint32_t j = 0; j < COLS; j += TILE_COLS) {
+      for (uint32_t r = 0; r < TILE_ROWS; r++) {
+        for (uint32_t c = 0; c < TILE_COLS; c++) {
+          n_errs += (buf[idx++] != (i + r) * COLS + j + c);
+        }
+      }
+    }
+  }
+  return n_errs;
+}
+
+// Layout transforms by cluster 0, see the routine above
+uint32_t test_layout(uint32_t *buf_dma, uint32_t *buf_tmp, uint32_t *buf_core, uint32_t *buf_col) {
+  uint32_t n_errs = 0;
+
+  if (snrt_is_dm_core()) {
+    for (uint32_t i = 0; i < ROWS * COLS; i++) l2_mat[i] = i;
+    for (uint32_t i = 0; i < IMG_C * IMG_H * IMG_W; i++) l2_img[i] = i;
+  }
+  snrt_cluster_hw_barrier();
+
+  // Transpose with the DMA
+  if (snrt_is_dm_core()) {
+    uint32_t start = snrt_mcycle();
+    pb_dma_transpose(buf_dma, l2_mat, ROWS, COLS, sizeof(uint32_t));
+    snrt_dma_wait_all();
+    cycles[0] = snrt_mcycle() - start;
+    n_errs += check_transpose(buf_dma);
+  }
+  snrt_cluster_hw_barrier();
+
+  // Transpose on the compute cores
+  uint32_t start = snrt_mcycle();
+  if (snrt_is_dm_core()) {
+    snrt_dma_start_1d(buf_tmp, l2_mat, ROWS * COLS * sizeof(uint32_t));
+    snrt_dma_wait_all();
+  }
+  snrt_cluster_hw_barrier();
+  if (snrt_is_compute_core()) {
+    for (uint32_t c = snrt_cluster_core_idx(); c < COLS; c += snrt_cluster_compute_core_num()) {
+      for (uint32_t r = 0; r < ROWS; r++) {
+        buf_core[c * ROWS + r] = buf_tmp[r * COLS + c];
+      }
+    }
+  }
+  snrt_cluster_hw_barrier();
+  if (snrt_is_dm_core()) {
+    cycles[1] = snrt_mcycle() - start;
+    n_errs += check_transpose(buf_core);
+  }
+
+  // im2col and blocked tiling
+  if (snrt_is_dm_core()) {
+    for (uint32_t stride = 1; stride <= 2; stride++) {
+      pb_dma_im2col(buf_col, l2_img, IMG_C, IMG_H, IMG_W, KERNEL, KERNEL, stride, sizeof(uint32_t));
+      snrt_dma_wait_all();
+      n_errs += check_im2col(buf_col, stride);
+    }
+
+    pb_dma_to_tiled(buf_dma, l2_mat, ROWS, COLS, TILE_ROWS, TILE_COLS, sizeof(uint32_t));
+    snrt_dma_wait_all();
+    n_errs += check_tiled(buf_dma);
+  }
+
+  return n_errs;
+}
+
+// Multicast of a tile and a transpose by cluster 0 to all other clusters
+uint32_t test_mcast(uint32_t *buf_dma, uint32_t *buf_tile, uint32_t *buf_trans) {
+  uint32_t n_errs = 0;
+
+  // `l2_mat` was initialized by cluster 0
+  snrt_global_barrier();
+  if (snrt_cluster_idx() == 0 && snrt_is_dm_core()) {
+    pb_dma_load_tile_mcast(snrt_remote_l1_ptr(buf_tile, 0, 1), l2_mat + MCAST_TILE_ROW * COLS + MCAST_TILE_COL,
+                           TILE_ROWS, TILE_COLS, COLS, sizeof(uint32_t), BCAST_MASK_ALL);
+    pb_dma_transpose_mcast(snrt_remote_l1_ptr(buf_trans, 0, 1), buf_dma, l2_mat, ROWS, COLS, sizeof(uint32_t),
+                           BCAST_MASK_ALL);
+    snrt_dma_wait_all();
+  }
+  snrt_global_barrier();
+
+  // As in the other multicast tests, only the receiving clusters check
+  if (snrt_cluster_idx() != 0 && snrt_is_dm_core()) {
+    for (uint32_t r = 0; r < TILE_ROWS; r++) {
+      for (uint32_t c = 0; c < TILE_COLS; c++) {
+        n_errs += (buf_tile[r * TILE_COLS + c] != (MCAST_TILE_ROW + r) * COLS + MCAST_TILE_COL + c);
+      }
+    }
+    n_errs += check_transpose(buf_trans);
+  }
+  return n_errs;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+
+  uint32_t *buf_dma  = (uint32_t *)snrt_l1_alloc_cluster_local(ROWS * COLS * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *buf_tmp  = (uint32_t *)snrt_l1_alloc_cluster_local(ROWS * COLS * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *buf_core = (uint32_t *)snrt_l1_alloc_cluster_local(ROWS * COLS * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *buf_col  = (uint32_t *)snrt_l1_alloc_cluster_local(
+      IMG_C * KERNEL * KERNEL * IMG_H * IMG_W * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *buf_tile  = (uint32_t *)snrt_l1_alloc_cluster_local(TILE_ROWS * TILE_COLS * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *buf_trans = (uint32_t *)snrt_l1_alloc_cluster_local(ROWS * COLS * sizeof(uint32_t), sizeof(uint32_t));
+
+  if (snrt_cluster_idx() == 0) n_errs += test_layout(buf_dma, buf_tmp, buf_core, buf_col);
+  n_errs += test_mcast(buf_dma, buf_tile, buf_trans);
+
+  return n_errs;
+}
@@ -0,0 +1,81 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the staging of DRAM-resident data through the L2 page
+// cache. The following routine is implemented:
+//   - The DM core of cluster 0 initializes the page cache and writes a
+//     pattern spanning more pages than there are frames to DRAM
+//   - The DM core of every cluster streams the pattern through the cache,
+//     prefetching ahead, and checks the data of every page
+//   - The DM core of cluster 0 produces a second region with a write
+//     stream, flushes the cache and checks the region in DRAM
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define PAGE_SIZE    1024
+#define NUM_FRAMES   8
+#define NUM_PAGES    20
+#define DEPTH        2
+#define REGION_WORDS (NUM_PAGES * PAGE_SIZE / sizeof(uint32_t))
+// Regions in DRAM, away from anything Cheshire may have placed there
+#define SRC_ADDR     (PB_DRAM_BASE + 0x10000000)
+#define DST_ADDR     (PB_DRAM_BASE + 0x10100000)
+
+pb_page_cache_t cache;
+uint8_t frames[NUM_FRAMES * PAGE_SIZE] __attribute__((aligned(PAGE_SIZE)));
+
+/* Helper functions */
+static inline uint32_t pattern(uint32_t i) { return 0x5A000000 + i * 7; }
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  uint32_t cluster = snrt_cluster_idx();
+  pb_page_stream_t s;
+  size_t len;
+
+  if (cluster == 0 && snrt_is_dm_core()) {
+    pb_page_cache_init(&cache, frames, NUM_FRAMES, PAGE_SIZE);
+    volatile uint32_t *src = (volatile uint32_t *)(uintptr_t)SRC_ADDR;
+    for (uint32_t i = 0; i < REGION_WORDS; i++) src[i] = pattern(i);
+  }
+  snrt_global_barrier();
+
+  // Every cluster reads the region, sharing the pages resident in L2
+  if (snrt_is_dm_core()) {
+    uint32_t i = 0;
+    pb_page_stream_init(&s, &cache, SRC_ADDR, REGION_WORDS * sizeof(uint32_t), DEPTH,
+                        PB_PAGE_STREAM_READ);
+    uint32_t *page;
+    while ((page = (uint32_t *)pb_page_stream_next(&s, &len))) {
+      for (uint32_t j = 0; j < len / sizeof(uint32_t); j++, i++) {
+        n_errs += (page[j] != pattern(i));
+      }
+    }
+    pb_page_stream_close(&s);
+    n_errs += (i != REGION_WORDS);
+  }
+  snrt_global_barrier();
+
+  // Cluster 0 produces a region, evicting dirty pages along the way
+  if (cluster == 0 && snrt_is_dm_core()) {
+    uint32_t i = 0;
+    pb_page_stream_init(&s, &cache, DST_ADDR, REGION_WORDS * sizeof(uint32_t), DEPTH,
+                        PB_PAGE_STREAM_WRITE);
+    uint32_t *page;
+    while ((page = (uint32_t *)pb_page_stream_next(&s, &len))) {
+      for (uint32_t j = 0; j < len / sizeof(uint32_t); j++, i++) page[j] = ~pattern(i);
+    }
+    pb_page_stream_close(&s);
+    pb_page_flush(&cache);
+
+    volatile uint32_t *dst = (volatile uint32_t *)(uintptr_t)DST_ADDR;
+    for (uint32_t k = 0; k < REGION_WORDS; k++) n_errs += (dst[k] != ~pattern(k));
+  }
+
+  return n_errs;
+}
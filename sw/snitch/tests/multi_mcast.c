@@ -16,8 +16,8 @@
 #include "snrt.h"
 
 /* Parameters */
-#define ROW_MASK 0x00300000
-#define COLUMN_MASK 0x000C0000
+#define ROW_MASK PB_TOPO_MCAST_ROW_MASK
+#define COLUMN_MASK PB_TOPO_MCAST_COL_MASK
 #define TESTVAL 0xABCD
 
 
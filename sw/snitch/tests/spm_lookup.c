@@ -0,0 +1,66 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the shared lookup region in the wide SPM tile.
+// The following routine is implemented:
+//   - The DM core of cluster 0 publishes a table to the lookup region
+//   - All compute cores of all clusters look up entries with narrow loads,
+//     while the DM core of cluster 0 keeps the SPM busy with wide bursts
+//   - Compute core 0 of every cluster copies a descriptor from the region
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define TABLE_OFFSET 0x0
+#define TABLE_LENGTH 64
+#define DESC_OFFSET  (TABLE_OFFSET + TABLE_LENGTH * sizeof(uint32_t))
+#define DESC_LENGTH  6
+#define BURST_OFFSET 0x1000
+#define BURST_SIZE   2048
+
+/* Helper functions */
+static inline uint32_t table_entry(uint32_t i) { return i * 0x01010101 + 7; }
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+
+  uint32_t *table = (uint32_t *)snrt_l1_alloc_cluster_local(TABLE_LENGTH * sizeof(uint32_t), sizeof(uint64_t));
+  uint32_t *desc  = (uint32_t *)snrt_l1_alloc_cluster_local(DESC_LENGTH * sizeof(uint32_t), sizeof(uint32_t));
+  uint8_t *burst  = (uint8_t *)snrt_l1_alloc_cluster_local(BURST_SIZE, 64);
+
+  if (snrt_cluster_idx() == 0 && snrt_is_dm_core()) {
+    for (uint32_t i = 0; i < TABLE_LENGTH; i++) table[i] = table_entry(i);
+    pb_lookup_publish(TABLE_OFFSET, table, TABLE_LENGTH * sizeof(uint32_t));
+    for (uint32_t i = 0; i < DESC_LENGTH; i++) pb_lookup_store32(DESC_OFFSET + i * sizeof(uint32_t), i + 1);
+  }
+  snrt_global_barrier();
+
+  if (snrt_is_compute_core()) {
+    // Every core starts at a different entry to spread the lookups
+    uint32_t start = snrt_cluster_idx() * snrt_cluster_compute_core_num() + snrt_cluster_core_idx();
+    for (uint32_t i = 0; i < TABLE_LENGTH; i++) {
+      uint32_t idx = (start + i) % TABLE_LENGTH;
+      n_errs += (pb_lookup_load32(TABLE_OFFSET + idx * sizeof(uint32_t)) != table_entry(idx));
+    }
+    uint64_t pair = pb_lookup_load64(TABLE_OFFSET + 2 * sizeof(uint32_t));
+    n_errs += ((uint32_t)pair != table_entry(2));
+    n_errs += ((uint32_t)(pair >> 32) != table_entry(3));
+
+    if (snrt_cluster_core_idx() == 0) {
+      pb_lookup_read(desc, DESC_OFFSET, DESC_LENGTH * sizeof(uint32_t));
+      for (uint32_t i = 0; i < DESC_LENGTH; i++) n_errs += (desc[i] != i + 1);
+    }
+  } else if (snrt_cluster_idx() == 0) {
+    // Wide bursts to a separate part of the region, competing for the banks
+    for (uint32_t i = 0; i < 4; i++) {
+      snrt_dma_start_1d((void *)pb_lookup_ptr(BURST_OFFSET), burst, BURST_SIZE);
+    }
+    snrt_dma_wait_all();
+  }
+
+  return n_errs;
+}
@@ -0,0 +1,130 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the work-stealing task scheduler of the Picobello runtime
+// on an irregular workload, where every task has a different duration.
+// The following routine is implemented:
+//   - In every cluster, compute core 0 spawns all tasks on its own deque,
+//     half of which request a DMA prefetch of their input data. The other
+//     cores have to steal to get work.
+//   - Compute core 0 of cluster 0 spawns tasks which all clusters steal
+//     through the remote TCDM of cluster 0.
+// Every task writes its result to a separate location, which is checked
+// against the expected value.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define NUM_LOCAL_TASKS PB_TASK_DEQUE_SIZE
+#define NUM_GLOBAL_TASKS 24
+#define PREFETCH_LENGTH 16
+
+uint32_t l2_input[PREFETCH_LENGTH];
+
+// Results and pending task counter of the cross-cluster phase
+uint32_t global_results[NUM_GLOBAL_TASKS];
+volatile uint32_t global_pending;
+
+/* Tasks */
+// Irregular amount of work, depending on the task index
+static inline uint32_t work(uint32_t idx) {
+  uint32_t acc = idx;
+  for (uint32_t i = 0; i < (idx % 7) * (idx % 7) * 8; i++) {
+    acc = acc * 1664525 + 1013904223;
+  }
+  return acc;
+}
+
+typedef struct {
+  uint32_t *results;
+  uint32_t *input;  // Prefetched input buffers, one per task
+} task_args_t;
+
+void compute_task(void *arg, uint32_t idx) {
+  task_args_t *args = (task_args_t *)arg;
+  args->results[idx] = work(idx);
+}
+
+void prefetch_task(void *arg, uint32_t idx) {
+  task_args_t *args = (task_args_t *)arg;
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < PREFETCH_LENGTH; i++) {
+    sum += args->input[idx * PREFETCH_LENGTH + i];
+  }
+  args->results[idx] = work(idx) + sum;
+}
+
+void global_task(void *arg, uint32_t idx) {
+  global_results[idx] = work(idx);
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  uint32_t input_sum = 0;
+
+  for (uint32_t i = 0; i < PREFETCH_LENGTH; i++) input_sum += i;
+
+  // Cluster-local phase
+  volatile uint32_t *pending = (volatile uint32_t *)snrt_l1_alloc_cluster_local(sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *results = (uint32_t *)snrt_l1_alloc_cluster_local(NUM_LOCAL_TASKS * sizeof(uint32_t), sizeof(uint32_t));
+  uint32_t *input = (uint32_t *)snrt_l1_alloc_cluster_local(NUM_LOCAL_TASKS * PREFETCH_LENGTH * sizeof(uint32_t), sizeof(uint32_t));
+  volatile uint32_t *ready = (volatile uint32_t *)snrt_l1_alloc_cluster_local(NUM_LOCAL_TASKS * sizeof(uint32_t), sizeof(uint32_t));
+  task_args_t *args = (task_args_t *)snrt_l1_alloc_cluster_local(sizeof(task_args_t), sizeof(uint32_t));
+
+  if (snrt_is_dm_core()) {
+    *pending = 0;
+    args->results = results;
+    args->input = input;
+    for (uint32_t i = 0; i < NUM_LOCAL_TASKS; i++) ready[i] = 0;
+    if (snrt_cluster_idx() == 0) {
+      global_pending = 0;
+      for (uint32_t i = 0; i < PREFETCH_LENGTH; i++) l2_input[i] = i;
+    }
+  }
+  snrt_global_barrier();
+
+  pb_task_sched_t *local_sched = pb_task_sched_init(pending, snrt_cluster_idx(), 1);
+  if (snrt_cluster_core_idx() == 0) {
+    for (uint32_t i = 0; i < NUM_LOCAL_TASKS; i++) {
+      if (i % 2) {
+        pb_task_spawn_prefetch(local_sched, prefetch_task, args, i, &input[i * PREFETCH_LENGTH], l2_input,
+                               PREFETCH_LENGTH * sizeof(uint32_t), &ready[i]);
+      } else {
+        pb_task_spawn(local_sched, compute_task, args, i);
+      }
+    }
+  }
+  snrt_cluster_hw_barrier();
+  pb_task_run(local_sched);
+  snrt_cluster_hw_barrier();
+
+  if (snrt_is_dm_core()) {
+    for (uint32_t i = 0; i < NUM_LOCAL_TASKS; i++) {
+      uint32_t expected = work(i) + ((i % 2) ? input_sum : 0);
+      n_errs += (results[i] != expected);
+    }
+  }
+
+  // Cross-cluster phase
+  pb_task_sched_t *global_sched = pb_task_sched_init(&global_pending, 0, snrt_cluster_num());
+  if (snrt_cluster_idx() == 0 && snrt_cluster_core_idx() == 0) {
+    for (uint32_t i = 0; i < NUM_GLOBAL_TASKS; i++) {
+      pb_task_spawn(global_sched, global_task, NULL, i);
+    }
+  }
+  snrt_global_barrier();
+  pb_task_run(global_sched);
+  snrt_global_barrier();
+
+  if (snrt_cluster_idx() == 0 && snrt_is_dm_core()) {
+    for (uint32_t i = 0; i < NUM_GLOBAL_TASKS; i++) {
+      n_errs += (global_results[i] != work(i));
+    }
+  }
+
+  return n_errs;
+}
@@ -0,0 +1,92 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the bank-aware L1 allocation and the TCDM conflict
+// profiler. The following routine is implemented:
+//   - Core 0 checks the start banks of skewed and bank-offset allocations,
+//     the padded pitches and the collisions estimated by the profiler
+//   - The compute cores of cluster 0 load from their buffers, first all on
+//     the same bank, then each on its own bank, while the DM core measures
+//     the TCDM congestion. The first kernel must be more congested.
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+#define LENGTH 64
+#define ITERS  64
+
+/* Helper functions */
+// Each compute core repeatedly loads its buffer with a stride of the bank
+// period, so that all its loads hit the start bank of the buffer
+static void load_kernel(uint64_t **bufs) {
+  if (snrt_is_compute_core()) {
+    volatile uint64_t *buf = bufs[snrt_cluster_core_idx()];
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < ITERS; i++) sum += buf[(i * PB_TCDM_NUM_BANKS) % LENGTH];
+    (void)sum;
+  }
+}
+
+// Profile a kernel on the cluster, returns the number of congested accesses
+static uint32_t profile(pb_tcdm_prof_t *prof, uint64_t **bufs, const char *kernel) {
+  if (snrt_is_dm_core()) pb_tcdm_prof_start(prof);
+  snrt_cluster_hw_barrier();
+  load_kernel(bufs);
+  snrt_cluster_hw_barrier();
+  if (snrt_is_dm_core()) {
+    pb_tcdm_prof_stop(prof);
+    pb_tcdm_prof_report(prof, kernel);
+  }
+  return prof->congested;
+}
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  uint32_t n_cores = snrt_cluster_compute_core_num();
+  uint64_t *same[CFG_CLUSTER_NR_CORES];
+  uint64_t *spread[CFG_CLUSTER_NR_CORES];
+  size_t sizes[CFG_CLUSTER_NR_CORES];
+
+  // All cores allocate in the same order
+  for (uint32_t c = 0; c < n_cores; c++) {
+    same[c] = (uint64_t *)pb_l1_alloc_at_bank(LENGTH * sizeof(uint64_t), 3);
+    sizes[c] = LENGTH * sizeof(uint64_t);
+  }
+  pb_l1_alloc_skewed((void **)spread, sizes, n_cores);
+
+  if (snrt_cluster_core_idx() == 0) {
+    uint32_t skew = PB_TCDM_NUM_BANKS / n_cores;
+    for (uint32_t c = 0; c < n_cores; c++) {
+      n_errs += (pb_tcdm_bank(same[c]) != 3);
+      n_errs += (pb_tcdm_bank(spread[c]) != c * skew);
+    }
+    n_errs += (pb_tcdm_padded_pitch(PB_TCDM_BANK_PERIOD) != PB_TCDM_BANK_PERIOD + PB_TCDM_BANK_WIDTH);
+    n_errs += (pb_tcdm_padded_pitch(3 * PB_TCDM_BANK_WIDTH) != 3 * PB_TCDM_BANK_WIDTH);
+
+    // Lockstep streams collide on every step if they start on the same bank
+    pb_tcdm_prof_t est;
+    uint32_t steps;
+    pb_tcdm_prof_init(&est);
+    pb_tcdm_prof_add(&est, "a", same[0], 8, 8, LENGTH);
+    pb_tcdm_prof_add(&est, "b", same[1], 8, 8, LENGTH);
+    pb_tcdm_prof_add(&est, "c", spread[0], 8, 8, LENGTH);
+    pb_tcdm_prof_add(&est, "d", spread[1], 8, 8, LENGTH);
+    n_errs += (pb_tcdm_collisions(&est.accesses[0], &est.accesses[1], &steps) != LENGTH);
+    n_errs += (pb_tcdm_collisions(&est.accesses[2], &est.accesses[3], &steps) != 0);
+    n_errs += (pb_tcdm_prof_report(&est, "estimate") == 0);
+  }
+
+  if (snrt_cluster_idx() == 0) {
+    pb_tcdm_prof_t prof;
+    pb_tcdm_prof_init(&prof);
+    uint32_t congested_same = profile(&prof, same, "same bank");
+    uint32_t congested_spread = profile(&prof, spread, "spread");
+    if (snrt_is_dm_core()) n_errs += (congested_same <= congested_spread);
+  }
+
+  return n_errs;
+}
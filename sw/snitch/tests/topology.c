@@ -0,0 +1,71 @@
+// Copyright 2025 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+//
+// This test checks the generated mesh topology and the placement helpers.
+// The following routine is implemented:
+//   - Core 0 of every cluster checks that its nearest L2 tile has the
+//     lowest hop distance in the topology tables
+//   - The DM core of every cluster writes a tag to a buffer placed in its
+//     nearest L2 tile, which cluster 0 reads back
+//   - The clusters in column 0 multicast a value to their row, using the
+//     destination and mask returned by the placement helpers
+
+#include <stdint.h>
+#include "pb_addrmap.h"
+#include "snrt.h"
+
+/* Parameters */
+// Offset of the test buffers in every L2 tile, away from the program
+#define L2_OFFSET 0xF0000
+#define TESTVAL   0xABCD
+
+/* Main Function */
+int main() {
+  uint32_t n_errs = 0;
+  uint32_t cluster = snrt_cluster_idx();
+
+  uint32_t *buf = (uint32_t *)snrt_l1_alloc_cluster_local(sizeof(uint32_t), sizeof(uint32_t));
+
+  if (snrt_cluster_core_idx() == 0) {
+    uint32_t nearest = pb_topo_cluster_nearest_l2[cluster];
+    for (uint32_t t = 0; t < PB_TOPO_NUM_L2_TILES; t++) {
+      n_errs += (pb_topo_cluster_l2_hops[cluster][t] < pb_topo_cluster_l2_hops[cluster][nearest]);
+    }
+    n_errs += (pb_topo_cluster_idx(pb_topo_cluster_x(cluster), pb_topo_cluster_y(cluster)) != cluster);
+  }
+
+  if (snrt_is_dm_core()) {
+    volatile uint32_t *tag = (volatile uint32_t *)pb_place_local_l2_ptr(L2_OFFSET + cluster * sizeof(uint32_t));
+    *tag = TESTVAL + cluster;
+    *buf = 0;
+  }
+  snrt_global_barrier();
+
+  // Cluster 0 reads back all tags from the L2 tiles they were placed in
+  if (cluster == 0 && snrt_is_dm_core()) {
+    for (uint32_t c = 0; c < snrt_cluster_num(); c++) {
+      volatile uint32_t *tag =
+          (volatile uint32_t *)(pb_place_nearest_l2_addr(c) + L2_OFFSET + c * sizeof(uint32_t));
+      n_errs += (*tag != TESTVAL + c);
+    }
+  }
+
+  // Row multicast from the clusters in column 0
+  if (snrt_is_dm_core() && pb_topo_cluster_x(cluster) == 0) {
+    uint32_t *src = (uint32_t *)pb_place_local_l2_ptr(L2_OFFSET + 0x1000);
+    uint32_t mask;
+    void *dst = pb_place_row_mcast_dst(buf, &mask);
+    *src = TESTVAL;
+    snrt_dma_start_1d_mcast(dst, src, sizeof(uint32_t), mask);
+    snrt_dma_wait_all();
+  }
+  snrt_global_barrier();
+
+  // The issuing cluster does not necessarily receive its own multicast
+  if (snrt_is_dm_core() && pb_topo_cluster_x(cluster) != 0) {
+    n_errs += (*buf != TESTVAL);
+  }
+
+  return n_errs;
+}
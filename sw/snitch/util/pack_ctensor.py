@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Offline packer for the compressed tensor format of the Picobello runtime.
+# See `sw/snitch/runtime/src/pb_ctensor.h` for a description of the format.
+
+import argparse
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = 0x54434250  # "PBCT"
+FLAG_SPARSE = 0x1
+FORMATS = {'fp32': 0, 'fp8': 1, 'int4': 2}
+HEADER_FMT = '<IHHIIIIII'
+# Alignment of the block data, matching the 512-bit wide DMA beats
+DATA_ALIGN = 64
+
+
+def fp8_e4m3_table():
+    """Return all finite E4M3 values, indexed by their encoding."""
+    vals = np.zeros(256, dtype=np.float64)
+    for b in range(256):
+        sign = -1.0 if b >> 7 else 1.0
+        exp = (b >> 3) & 0xF
+        man = b & 0x7
+        if exp == 0xF and man == 0x7:
+            vals[b] = np.nan
+        elif exp == 0:
+            vals[b] = sign * man * 2.0**-9
+        else:
+            vals[b] = sign * (1 + man / 8) * 2.0**(exp - 7)
+    return vals
+
+
+FP8_TABLE = fp8_e4m3_table()
+FP8_MAX = 448.0
+
+
+def encode_fp8(x):
+    """Round every element to the nearest E4M3 encoding."""
+    codes = np.arange(128)  # Positive encodings, excluding NaN
+    pos = FP8_TABLE[:127]
+    mag = np.abs(x)
+    idx = np.clip(np.searchsorted(pos, mag), 1, 126)
+    lower = mag - pos[idx - 1] <= pos[idx] - mag
+    enc = np.where(lower, codes[idx - 1], codes[idx])
+    enc = np.where(x < 0, enc | 0x80, enc)
+    return enc.astype(np.uint8)
+
+
+def encode_block(block, fmt):
+    """Return the scale and the encoded payload of a block."""
+    amax = float(np.max(np.abs(block)))
+    if fmt == 'fp32':
+        return 1.0, block.astype('<f4').tobytes()
+    if fmt == 'fp8':
+        scale = amax / FP8_MAX if amax > 0 else 1.0
+        return scale, encode_fp8(block / scale).tobytes()
+    scale = amax / 7 if amax > 0 else 1.0
+    q = np.clip(np.round(block / scale), -8, 7).astype(np.int8) & 0xF
+    return scale, (q[0::2] | (q[1::2] << 4)).astype(np.uint8).tobytes()
+
+
+def pack(tensor, fmt, block_len, sparse):
+    """Pack a tensor, returning the compressed image as bytes."""
+    if block_len % 16:
+        raise ValueError('The block length must be a multiple of 16')
+    flat = np.asarray(tensor, dtype=np.float32).flatten()
+    num_blocks = -(-flat.size // block_len)
+    flat = np.pad(flat, (0, num_blocks * block_len - flat.size))
+    blocks = flat.reshape(num_blocks, block_len)
+
+    stored = np.ones(num_blocks, dtype=bool)
+    if sparse:
+        stored = np.any(blocks != 0, axis=1)
+
+    payload_bytes = {'fp32': 4 * block_len, 'fp8': block_len, 'int4': block_len // 2}[fmt]
+    block_bytes = (4 + payload_bytes + 7) & ~7
+
+    header_size = struct.calcsize(HEADER_FMT)
+    bitmap_offset = header_size
+    bitmap_size = 4 * (-(-num_blocks // 32)) if sparse else 0
+    data_offset = -(-(bitmap_offset + bitmap_size) // DATA_ALIGN) * DATA_ALIGN
+
+    bitmap = np.zeros(bitmap_size // 4, dtype='<u4')
+    if sparse:
+        for b in np.flatnonzero(stored):
+            bitmap[b // 32] |= np.uint32(1 << (b % 32))
+
+    data = bytearray()
+    for b in np.flatnonzero(stored):
+        scale, enc = encode_block(blocks[b], fmt)
+        blk = struct.pack('<f', scale) + enc
+        data += blk + bytes(block_bytes - len(blk))
+
+    flags = FLAG_SPARSE if sparse else 0
+    header = struct.pack(HEADER_FMT, MAGIC, FORMATS[fmt], flags, flat.size, block_len,
+                         num_blocks, int(stored.sum()), bitmap_offset, data_offset)
+    image = header + bitmap.tobytes()
+    image += bytes(data_offset - len(image))
+    return image + bytes(data)
+
+
+def decode_block(blk, fmt, block_len):
+    """Decode a stored block into FP32 elements, as done by the runtime."""
+    scale = np.frombuffer(blk[:4], dtype='<f4')[0]
+    payload = blk[4:]
+    if fmt == 'fp32':
+        return np.frombuffer(payload[:4 * block_len], dtype='<f4').copy()
+    if fmt == 'fp8':
+        enc = np.frombuffer(payload[:block_len], dtype=np.uint8)
+        return FP8_TABLE[enc].astype(np.float32) * scale
+    b = np.frombuffer(payload[:block_len // 2], dtype=np.int8)
+    q = np.empty(block_len, dtype=np.int8)
+    q[0::2] = (b << 4).astype(np.int8) >> 4
+    q[1::2] = b >> 4
+    return q.astype(np.float32) * scale
+
+
+def unpack(image):
+    """Decompress an image produced by `pack`, returning its FP32 elements."""
+    (magic, fmt_id, flags, num_elems, block_len, num_blocks, _, bitmap_offset,
+     data_offset) = struct.unpack_from(HEADER_FMT, image)
+    if magic != MAGIC:
+        raise ValueError('Not a compressed tensor')
+    fmt = {v: k for k, v in FORMATS.items()}[fmt_id]
+    payload_bytes = {'fp32': 4 * block_len, 'fp8': block_len, 'int4': block_len // 2}[fmt]
+    block_bytes = (4 + payload_bytes + 7) & ~7
+
+    out = np.zeros(num_elems, dtype=np.float32)
+    rank = 0
+    for b in range(num_blocks):
+        if flags & FLAG_SPARSE:
+            word, = struct.unpack_from('<I', image, bitmap_offset + 4 * (b // 32))
+            if not (word >> (b % 32)) & 1:
+                continue
+        blk = image[data_offset + rank * block_bytes:data_offset + (rank + 1) * block_bytes]
+        out[b * block_len:(b + 1) * block_len] = decode_block(blk, fmt, block_len)
+        rank += 1
+    return out
+
+
+def emit_c_header(image, name, ref=False):
+    lines = [
+        '// Generated by pack_ctensor.py, do not edit.',
+        '',
+        '#pragma once',
+        '',
+        '#include <stdint.h>',
+        '',
+        f'const uint8_t {name}[{len(image)}] __attribute__((aligned({DATA_ALIGN}))) = {{',
+    ]
+    for i in range(0, len(image), 16):
+        lines.append('    ' + ', '.join(f'0x{b:02x}' for b in image[i:i + 16]) + ',')
+    lines.append('};')
+    if ref:
+        vals = unpack(image)
+        lines += ['', '// Decompressed elements, to check the runtime against',
+                  f'const float {name}_ref[{len(vals)}] = {{']
+        for i in range(0, len(vals), 4):
+            lines.append('    ' + ', '.join(f'{float(v):.8e}f' for v in vals[i:i + 4]) + ',')
+        lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pack a tensor into the Picobello '
+                                     'compressed tensor format.')
+    parser.add_argument('input', help='Input tensor, as a .npy file')
+    parser.add_argument('-o', '--output', required=True,
+                        help='Output file. A C header is emitted if it ends in .h, '
+                        'a raw binary image otherwise.')
+    parser.add_argument('-f', '--format', choices=FORMATS.keys(), default='int4')
+    parser.add_argument('-b', '--block-len', type=int, default=64,
+                        help='Number of elements per block')
+    parser.add_argument('-s', '--sparse', action='store_true',
+                        help='Omit blocks which are entirely zero')
+    parser.add_argument('-n', '--name', default='ctensor',
+                        help='Name of the array in the C header')
+    parser.add_argument('-r', '--ref', action='store_true',
+                        help='Also emit the decompressed elements in the C header, '
+                        'as `<name>_ref`')
+    args = parser.parse_args()
+
+    image = pack(np.load(args.input), args.format, args.block_len, args.sparse)
+    if args.output.endswith('.h'):
+        with open(args.output, 'w') as f:
+            f.write(emit_c_header(image, args.name, args.ref))
+    else:
+        with open(args.output, 'wb') as f:
+            f.write(image)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -28,9 +28,9 @@ SN_RVTESTS_BUILDDIR = $(PB_SNITCH_SW_DIR)/riscv-tests/build
 SNRT_INCDIRS        = $(PB_INCDIR) $(PB_GEN_DIR)
 SNRT_BUILD_APPS     = OFF
 SNRT_MEMORY_LD      = $(PB_SNITCH_SW_DIR)/memory.ld
-SNRT_HAL_HDRS       = $(PB_GEN_DIR)/pb_addrmap.h
+SNRT_HAL_HDRS       = $(PB_GEN_DIR)/pb_addrmap.h $(PB_GEN_DIR)/pb_topology.h
 
-ifneq (,$(filter chs-bootrom% chs-sw% sn% pb-sn-tests% sw%,$(MAKECMDGOALS)))
+ifneq (,$(filter chs-bootrom% chs-sw% sn% pb-sn-tests% pb-sn-bench% sw%,$(MAKECMDGOALS)))
 include $(SN_ROOT)/target/snitch_cluster/sw.mk
 endif
 
@@ -48,7 +48,7 @@ pb-sn-tests: $(PB_SNRT_TEST_ELFS) $(PB_SNRT_TEST_DUMP)
 clean-pb-sn-tests:
 	rm -rf $(PB_SNRT_TEST_ELFS)
 
-$(PB_SNRT_TEST_ELFS): $(PB_GEN_DIR)/pb_addrmap.h
+$(PB_SNRT_TEST_ELFS): $(PB_GEN_DIR)/pb_addrmap.h $(PB_GEN_DIR)/pb_topology.h
 
 $(PB_SNRT_TESTS_BUILDDIR)/%.d: $(PB_SNRT_TESTS_DIR)/%.c | $(PB_SNRT_TESTS_BUILDDIR)
 	$(RISCV_CXX) $(SNRT_TESTS_RISCV_CFLAGS) -MM -MT '$(@:.d=.elf)' -x c++ $< > $@
@@ -59,6 +59,44 @@ $(PB_SNRT_TESTS_BUILDDIR)/%.elf: $(PB_SNRT_TESTS_DIR)/%.c $(SNRT_LIB) | $(PB_SNR
 $(PB_SNRT_TESTS_BUILDDIR)/%.dump: $(PB_SNRT_TESTS_BUILDDIR)/%.elf | $(PB_SNRT_TESTS_BUILDDIR)
 	$(RISCV_OBJDUMP) $(RISCV_OBJDUMP_FLAGS) $< > $@
 
+# Collect Snitch benchmarks, which are offloaded with `bench_offload.spm.elf`
+PB_SNRT_BENCH_DIR      = $(PB_SNITCH_SW_DIR)/bench
+PB_SNRT_BENCH_BUILDDIR = $(PB_SNITCH_SW_DIR)/bench/build
+PB_SNRT_BENCH_NAMES = $(basename $(notdir $(wildcard $(PB_SNRT_BENCH_DIR)/*.c)))
+PB_SNRT_BENCH_ELFS = $(abspath $(addprefix $(PB_SNRT_BENCH_BUILDDIR)/,$(addsuffix .elf,$(PB_SNRT_BENCH_NAMES))))
+PB_SNRT_BENCH_DUMP = $(abspath $(addprefix $(PB_SNRT_BENCH_BUILDDIR)/,$(addsuffix .dump,$(PB_SNRT_BENCH_NAMES))))
+
+# Baselines and simulation transcript checked by `pb-bench-check`
+PB_BENCH_BASELINES ?= $(PB_SNRT_BENCH_DIR)/baselines.yml
+PB_BENCH_LOG       ?= $(PB_ROOT)/transcript
+# Set to 1 to only warn about workloads without a baseline
+PB_BENCH_ALLOW_MISSING ?= 0
+
+.PHONY: pb-sn-bench clean-pb-sn-bench pb-bench-check pb-bench-update
+
+pb-sn-bench: $(PB_SNRT_BENCH_ELFS) $(PB_SNRT_BENCH_DUMP)
+
+clean-pb-sn-bench:
+	rm -rf $(PB_SNRT_BENCH_BUILDDIR)
+
+$(PB_SNRT_BENCH_ELFS): $(PB_GEN_DIR)/pb_addrmap.h $(PB_GEN_DIR)/pb_topology.h $(PB_SNRT_BENCH_DIR)/bench.h $(PB_INCDIR)/pb_bench.h
+
+$(PB_SNRT_BENCH_BUILDDIR):
+	mkdir -p $@
+
+$(PB_SNRT_BENCH_BUILDDIR)/%.elf: $(PB_SNRT_BENCH_DIR)/%.c $(SNRT_LIB) | $(PB_SNRT_BENCH_BUILDDIR)
+	$(RISCV_CXX) $(SNRT_TESTS_RISCV_CFLAGS) $(SNRT_TESTS_RISCV_LDFLAGS) -x c++ $< -o $@
+
+$(PB_SNRT_BENCH_BUILDDIR)/%.dump: $(PB_SNRT_BENCH_BUILDDIR)/%.elf | $(PB_SNRT_BENCH_BUILDDIR)
+	$(RISCV_OBJDUMP) $(RISCV_OBJDUMP_FLAGS) $< > $@
+
+pb-bench-check:
+	$(BASE_PYTHON) $(PB_ROOT)/util/bench_check.py --baselines $(PB_BENCH_BASELINES) \
+		$(if $(filter 1,$(PB_BENCH_ALLOW_MISSING)),--allow-missing) $(PB_BENCH_LOG)
+
+pb-bench-update:
+	$(BASE_PYTHON) $(PB_ROOT)/util/bench_check.py --baselines $(PB_BENCH_BASELINES) --update $(PB_BENCH_LOG)
+
 ##############
 ## Cheshire ##
 ##############
@@ -77,7 +115,7 @@ PB_CHS_SW_TEST_ELF += $(PB_CHS_SW_TEST_SRC:.c=.$(PB_LINK_MODE).elf)
 
 PB_CHS_SW_TEST = $(PB_CHS_SW_TEST_DUMP)
 
-$(PB_CHS_SW_TEST_SRC): $(PB_GEN_DIR)/pb_addrmap.h
+$(PB_CHS_SW_TEST_SRC): $(PB_GEN_DIR)/pb_addrmap.h $(PB_GEN_DIR)/pb_topology.h
 $(PB_CHS_SW_TEST_DUMP): $(PB_CHS_SW_TEST_ELF)
 
 .PHONY: chs-sw-tests chs-sw-tests-clean
@@ -99,4 +137,4 @@ sn-runtime-clean: sn-clean-runtime
 .PHONY: sw sw-tests sw-clean sw-tests-clean
 sw sw-tests: chs-sw-tests sn-tests pb-sn-tests
 
-sw-clean sw-tests-clean: chs-sw-tests-clean sn-tests-clean sn-runtime-clean clean-pb-sn-tests
+sw-clean sw-tests-clean: chs-sw-tests-clean sn-tests-clean sn-runtime-clean clean-pb-sn-tests clean-pb-sn-bench
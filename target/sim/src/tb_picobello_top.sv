@@ -17,13 +17,23 @@ module tb_picobello_top;
   string        preload_elf;
   string        boot_hex;
   logic  [ 1:0] boot_mode;
-  logic  [ 1:0] preload_mode;
+  logic  [ 2:0] preload_mode;
   bit    [31:0] exit_code;
   bit           snitch_preload;
   string        snitch_elf;
   logic  [63:0] snitch_entry;
   int           snitch_fn;
   int           chs_fn;
+  string        stream_in_file;
+  string        stream_out_file;
+  string        dump_file;
+  longint       stream_in_addr;
+  longint       stream_in_chunk;
+  longint       stream_out_addr;
+  longint       dump_addr;
+  longint       dump_size;
+  bit           stream_in_done;
+  bit           stream_out_done;
 
   initial begin
     // Fetch plusargs or use safe (fail-fast) defaults
@@ -31,6 +41,16 @@ module tb_picobello_top;
     if (!$value$plusargs("PRELMODE=%d", preload_mode)) preload_mode = 1;
     if (!$value$plusargs("IMAGE=%s", boot_hex)) boot_hex = "";
 
+    // Serial link burst mode: optional streams and readback
+    if (!$value$plusargs("STREAM_IN=%s", stream_in_file)) stream_in_file = "";
+    if (!$value$plusargs("STREAM_IN_ADDR=%h", stream_in_addr)) stream_in_addr = 0;
+    if (!$value$plusargs("STREAM_IN_CHUNK=%d", stream_in_chunk)) stream_in_chunk = 4096;
+    if (!$value$plusargs("STREAM_OUT=%s", stream_out_file)) stream_out_file = "";
+    if (!$value$plusargs("STREAM_OUT_ADDR=%h", stream_out_addr)) stream_out_addr = 0;
+    if (!$value$plusargs("DUMP=%s", dump_file)) dump_file = "";
+    if (!$value$plusargs("DUMP_ADDR=%h", dump_addr)) dump_addr = 0;
+    if (!$value$plusargs("DUMP_SIZE=%d", dump_size)) dump_size = 0;
+
     if ($value$plusargs("CHS_BINARY=%s", preload_elf)) begin
       chs_fn = $fopen(".chsbinary", "w");
       $fwrite(chs_fn, preload_elf);
@@ -84,6 +104,41 @@ module tb_picobello_top;
           fix.vip.jtag_wait_for_eoc(exit_code);
           if (snitch_preload) fastmode_read();
         end
+        4: begin  // Serial Link, burst mode
+          slink_enable_tiles();  // Write control registers
+          if (snitch_preload) slink_burst_elf_preload(snitch_elf, snitch_entry);
+          // Streams run concurrently with the program, from empty mailboxes
+          stream_in_done  = (stream_in_file == "");
+          stream_out_done = (stream_out_file == "");
+          if (!stream_in_done) slink_stream_init(stream_in_addr);
+          if (!stream_out_done) slink_stream_init(stream_out_addr);
+          slink_burst_elf_run(preload_elf);
+          fork
+            if (!stream_in_done) begin
+              slink_stream_in(stream_in_file, stream_in_addr, stream_in_chunk);
+              stream_in_done = 1;
+            end
+            if (!stream_out_done) begin
+              slink_stream_out(stream_out_file, stream_out_addr);
+              stream_out_done = 1;
+            end
+          join_none
+          slink_burst_wait_for_eoc(exit_code);
+          // The program may exit right after closing its streams, so let them
+          // reach the end of file before stopping them
+          fork
+            wait (stream_in_done && stream_out_done);
+            begin
+              repeat (SlinkStreamEndTimeout) @(posedge fix.clk);
+              $error("[SLINK] Timeout waiting for the end of the streams");
+            end
+          join_any
+          // Hold the link while stopping the streams, so none is killed mid-transfer
+          slink_lock.get();
+          disable fork;
+          slink_lock.put();
+          if (dump_file != "") slink_burst_dump(dump_file, dump_addr, dump_size);
+        end
         default: begin
           $fatal(1, "Unsupported preload mode %d (reserved)!", boot_mode);
         end
@@ -33,6 +33,14 @@ $(eval $(call add_vsim_flag,CHS_BINARY))
 $(eval $(call add_vsim_flag,SN_BINARY))
 $(eval $(call add_vsim_flag,BOOTMODE))
 $(eval $(call add_vsim_flag,PRELMODE))
+$(eval $(call add_vsim_flag,STREAM_IN))
+$(eval $(call add_vsim_flag,STREAM_IN_ADDR))
+$(eval $(call add_vsim_flag,STREAM_IN_CHUNK))
+$(eval $(call add_vsim_flag,STREAM_OUT))
+$(eval $(call add_vsim_flag,STREAM_OUT_ADDR))
+$(eval $(call add_vsim_flag,DUMP))
+$(eval $(call add_vsim_flag,DUMP_ADDR))
+$(eval $(call add_vsim_flag,DUMP_SIZE))
 
 .PHONY: vsim-compile vsim-clean vsim-run
 
@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Compare the results of the end-to-end benchmarks against their baselines.
+#
+# Parses the `[bench]` lines printed by `sw/cheshire/tests/bench_offload.c`
+# from one or more simulation transcripts, reports the achieved FLOP/cycle
+# and the bytes moved per memory level, and fails if the end-to-end cycles
+# of a workload exceed its baseline by more than the tolerance, or if a
+# workload has no baseline (unless `--allow-missing` is given). With
+# `--update`, the baselines are replaced by the measured cycles instead.
+
+import argparse
+import re
+import sys
+
+import yaml
+
+RESULT_RE = re.compile(r'\[bench\] (\S+)((?: \w+=\S+)+)')
+
+
+def parse_logs(paths):
+    """Return the results found in the given transcripts, by workload."""
+    results = {}
+    for path in paths:
+        with open(path, encoding='utf-8', errors='replace') as f:
+            for line in f:
+                match = RESULT_RE.search(line)
+                if not match:
+                    continue
+                fields = dict(kv.split('=', 1) for kv in match.group(2).split())
+                results[match.group(1)] = {
+                    'cycles': int(fields['cycles']),
+                    'flop': int(fields['flop']),
+                    'peak': int(fields['peak']),
+                    'l1_bytes': int(fields['l1_bytes']),
+                    'l2_bytes': int(fields['l2_bytes']),
+                }
+    return results
+
+
+def load_baselines(path):
+    """Return the header comment and the content of a baselines file."""
+    with open(path, encoding='utf-8') as f:
+        text = f.read()
+    header = ''.join(line + '\n' for line in text.splitlines() if line.startswith('#'))
+    return header, yaml.safe_load(text) or {}
+
+
+def write_baselines(path, header, baselines):
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write(header)
+        yaml.safe_dump(baselines, f, sort_keys=False)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare benchmark results against their baselines')
+    parser.add_argument('logs', nargs='+', help='Simulation transcripts')
+    parser.add_argument('--baselines', required=True, help='Baselines file (YAML)')
+    parser.add_argument('--tolerance', type=float,
+                        help='Allowed relative cycle increase, overrides the baselines file')
+    parser.add_argument('--update', action='store_true',
+                        help='Replace the baselines by the measured cycles')
+    parser.add_argument('--allow-missing', action='store_true',
+                        help='Only warn about workloads without a baseline')
+    args = parser.parse_args()
+
+    results = parse_logs(args.logs)
+    if not results:
+        print('error: no benchmark results found', file=sys.stderr)
+        return 1
+
+    header, baselines = load_baselines(args.baselines)
+    workloads = baselines.get('workloads') or {}
+    baselines['workloads'] = workloads
+    tolerance = args.tolerance if args.tolerance is not None else baselines.get('tolerance', 0.05)
+
+    regressions = 0
+    missing = []
+    print(f"{'workload':<20} {'cycles':>10} {'baseline':>10} {'delta':>8} "
+          f"{'flop/cyc':>9} {'util':>7} {'l1_bytes':>12} {'l2_bytes':>12}  status")
+    for name, res in results.items():
+        base = workloads.get(name)
+        flop_per_cycle = res['flop'] / res['cycles'] if res['cycles'] else 0.0
+        util = 100.0 * flop_per_cycle / res['peak'] if res['peak'] else 0.0
+        if base is None:
+            delta, status = '', 'MISSING'
+            missing.append(name)
+        else:
+            rel = res['cycles'] / base - 1.0
+            delta = f'{100.0 * rel:+.1f}%'
+            if rel > tolerance:
+                status = 'REGRESSION'
+                regressions += 1
+            elif rel < -tolerance:
+                status = 'IMPROVED'
+            else:
+                status = 'OK'
+        print(f"{name:<20} {res['cycles']:>10} {base if base is not None else '-':>10} "
+              f"{delta:>8} {flop_per_cycle:>9.3f} {util:>6.1f}% {res['l1_bytes']:>12} "
+              f"{res['l2_bytes']:>12}  {status}")
+        if args.update:
+            workloads[name] = res['cycles']
+
+    if args.update:
+        write_baselines(args.baselines, header, baselines)
+        print(f'Updated {len(results)} baselines in {args.baselines}')
+        return 0
+
+    if missing:
+        level = 'warning' if args.allow_missing else 'error'
+        print(f'{level}: no baseline for {len(missing)} workload(s): {", ".join(missing)}\n'
+              f'{level}: their cycles are NOT checked, record them with `make pb-bench-update`',
+              file=sys.stderr)
+    if regressions:
+        print(f'error: {regressions} workload(s) regressed by more than '
+              f'{100.0 * tolerance:.1f}%', file=sys.stderr)
+        return 1
+    if missing and not args.allow_missing:
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+# Copyright 2025 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Generate a C/C++ header describing the mesh topology of a FlooNoC
+# configuration: tile coordinates, hop distances, multicast mask
+# encodings and the nearest L2 tile of every cluster.
+
+import argparse
+import itertools
+import math
+import sys
+
+import yaml
+
+CLUSTER_EP = 'cluster'
+L2_EP = 'l2_spm'
+
+
+def expand_range(rng):
+    """Expand a list of inclusive per-dimension ranges into index tuples."""
+    return list(itertools.product(*[range(lo, hi + 1) for lo, hi in rng]))
+
+
+def flat_index(idx, array):
+    """Flatten a multi-dimensional endpoint index, last dimension fastest."""
+    flat = 0
+    for i, dim in zip(idx, array):
+        flat = flat * dim + i
+    return flat
+
+
+def get_coords(cfg):
+    """Return the logical XY coordinates of every endpoint instance."""
+    routers = {r['name']: r for r in cfg['routers']}
+    endpoints = {e['name']: e for e in cfg['endpoints']}
+    coords = {}
+    for conn in cfg['connections']:
+        if conn['src'] not in endpoints or conn['dst'] not in routers:
+            continue
+        ep = endpoints[conn['src']]
+        router = routers[conn['dst']]
+        offset = router.get('xy_id_offset', {})
+        array = ep.get('array', [1])
+
+        if 'src_range' in conn:
+            src = expand_range(conn['src_range'])
+        elif 'src_idx' in conn:
+            src = [tuple(conn['src_idx'])]
+        else:
+            src = [tuple(0 for _ in array)]
+        if 'dst_range' in conn:
+            dst = expand_range(conn['dst_range'])
+        else:
+            dst = [tuple(conn['dst_idx'])]
+        if len(src) != len(dst):
+            raise ValueError(f"Mismatching ranges in connection {conn['src']}->{conn['dst']}")
+
+        for s, d in zip(src, dst):
+            x = d[0] + offset.get('x', 0)
+            y = d[1] + offset.get('y', 0)
+            coords.setdefault(ep['name'], {})[flat_index(s, array)] = (x, y)
+    return coords
+
+
+def physical_x(coords):
+    """Map logical X coordinates to physical ones, removing empty columns."""
+    used = sorted({x for ep in coords.values() for (x, _) in ep.values()})
+    return {x: i for i, x in enumerate(used)}
+
+
+def hops(a, b):
+    """Number of router hops between two tiles with XY routing."""
+    return abs(a[0] - b[0]) + abs(a[1] - b[1])
+
+
+def render(cfg):
+    coords = get_coords(cfg)
+    phys = physical_x(coords)
+    endpoints = {e['name']: e for e in cfg['endpoints']}
+
+    def to_phys(c):
+        return (phys[c[0]], c[1])
+
+    cl_ep = endpoints[CLUSTER_EP]
+    cl_array = cl_ep['array']
+    num_clusters = math.prod(cl_array)
+    cl_log = [coords[CLUSTER_EP][i] for i in range(num_clusters)]
+    cl_phys = [to_phys(c) for c in cl_log]
+
+    l2_ep = endpoints[L2_EP]
+    num_l2 = math.prod(l2_ep.get('array', [1]))
+    l2_log = [coords[L2_EP][i] for i in range(num_l2)]
+    l2_phys = [to_phys(c) for c in l2_log]
+
+    l2_hops = [[hops(c, l) for l in l2_phys] for c in cl_phys]
+    # Ties are broken by the lowest tile index
+    nearest = [min(range(num_l2), key=lambda i: (h[i], i)) for h in l2_hops]
+
+    # Multicast masks select clusters through their address bits. The Y
+    # index occupies the lowest bits above the cluster address space, the
+    # X index the bits above.
+    cl_size = cl_ep['addr_range']['size']
+    dim_x = cl_array[0]
+    dim_y = cl_array[1] if len(cl_array) > 1 else 1
+    mask_y_off = int(math.log2(cl_size))
+    mask_y_len = math.ceil(math.log2(dim_y)) if dim_y > 1 else 0
+    mask_x_off = mask_y_off + mask_y_len
+    mask_x_len = math.ceil(math.log2(dim_x)) if dim_x > 1 else 0
+
+    mesh_x = len(phys)
+    mesh_y = max(y for ep in coords.values() for (_, y) in ep.values()) + 1
+
+    def coord_list(cs):
+        return ',\n'.join(f'    {{{x}, {y}}}' for x, y in cs)
+
+    def int_list(vals):
+        return ', '.join(str(v) for v in vals)
+
+    hops_rows = ',\n'.join('    {' + int_list(h) + '}' for h in l2_hops)
+
+    out = f"""// Generated by gen_topology.py from `{cfg['name']}`, do not edit.
+//
+// Mesh topology of the system. Logical coordinates are the FlooNoC
+// router IDs, physical coordinates skip empty mesh columns and are used
+// to compute hop distances with XY routing.
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+#define PB_TOPO_CONST constexpr
+#define PB_TOPO_FUNC constexpr inline
+#else
+#define PB_TOPO_CONST static const
+#define PB_TOPO_FUNC static inline
+#endif
+
+#define PB_TOPO_NUM_CLUSTERS {num_clusters}
+#define PB_TOPO_NUM_L2_TILES {num_l2}
+
+// Address map of the L2 tiles
+#define PB_TOPO_L2_BASE 0x{l2_ep['addr_range']['base']:08X}
+#define PB_TOPO_L2_TILE_SIZE 0x{l2_ep['addr_range']['size']:08X}
+
+// Dimensions of the cluster array and of the physical mesh
+#define PB_TOPO_CLUSTER_DIM_X {dim_x}
+#define PB_TOPO_CLUSTER_DIM_Y {dim_y}
+#define PB_TOPO_MESH_DIM_X {mesh_x}
+#define PB_TOPO_MESH_DIM_Y {mesh_y}
+
+// Position of the X and Y cluster indices in the multicast mask
+#define PB_TOPO_MCAST_X_OFFSET {mask_x_off}
+#define PB_TOPO_MCAST_X_LEN {mask_x_len}
+#define PB_TOPO_MCAST_Y_OFFSET {mask_y_off}
+#define PB_TOPO_MCAST_Y_LEN {mask_y_len}
+
+// Multicast to all clusters with the same Y index (a mesh row)
+#define PB_TOPO_MCAST_ROW_MASK 0x{((1 << mask_x_len) - 1) << mask_x_off:08X}
+// Multicast to all clusters with the same X index (a mesh column)
+#define PB_TOPO_MCAST_COL_MASK 0x{((1 << mask_y_len) - 1) << mask_y_off:08X}
+// Multicast to all clusters
+#define PB_TOPO_MCAST_ALL_MASK (PB_TOPO_MCAST_ROW_MASK | PB_TOPO_MCAST_COL_MASK)
+
+typedef struct {{
+    uint8_t x;
+    uint8_t y;
+}} pb_topo_coord_t;
+
+// Logical coordinates (router IDs) of every cluster
+PB_TOPO_CONST pb_topo_coord_t pb_topo_cluster_id[PB_TOPO_NUM_CLUSTERS] = {{
+{coord_list(cl_log)}
+}};
+
+// Physical coordinates of every cluster
+PB_TOPO_CONST pb_topo_coord_t pb_topo_cluster_coord[PB_TOPO_NUM_CLUSTERS] = {{
+{coord_list(cl_phys)}
+}};
+
+// Logical coordinates (router IDs) of every L2 tile
+PB_TOPO_CONST pb_topo_coord_t pb_topo_l2_id[PB_TOPO_NUM_L2_TILES] = {{
+{coord_list(l2_log)}
+}};
+
+// Physical coordinates of every L2 tile
+PB_TOPO_CONST pb_topo_coord_t pb_topo_l2_coord[PB_TOPO_NUM_L2_TILES] = {{
+{coord_list(l2_phys)}
+}};
+
+// Hop distance from every cluster to every L2 tile
+PB_TOPO_CONST uint8_t pb_topo_cluster_l2_hops[PB_TOPO_NUM_CLUSTERS][PB_TOPO_NUM_L2_TILES] = {{
+{hops_rows}
+}};
+
+// Index of the closest L2 tile of every cluster
+PB_TOPO_CONST uint8_t pb_topo_cluster_nearest_l2[PB_TOPO_NUM_CLUSTERS] = {{
+    {int_list(nearest)}
+}};
+
+// Number of router hops between two tiles, given their physical coordinates
+PB_TOPO_FUNC uint32_t pb_topo_hops(pb_topo_coord_t a, pb_topo_coord_t b) {{
+    return (a.x > b.x ? a.x - b.x : b.x - a.x) + (a.y > b.y ? a.y - b.y : b.y - a.y);
+}}
+
+// Number of router hops between two clusters
+PB_TOPO_FUNC uint32_t pb_topo_cluster_hops(uint32_t a, uint32_t b) {{
+    return pb_topo_hops(pb_topo_cluster_coord[a], pb_topo_cluster_coord[b]);
+}}
+
+// Index of the cluster at position (x, y) of the cluster array
+PB_TOPO_FUNC uint32_t pb_topo_cluster_idx(uint32_t x, uint32_t y) {{
+    return x * PB_TOPO_CLUSTER_DIM_Y + y;
+}}
+
+// Base address of an L2 tile
+PB_TOPO_FUNC uintptr_t pb_topo_l2_tile_addr(uint32_t tile) {{
+    return PB_TOPO_L2_BASE + tile * PB_TOPO_L2_TILE_SIZE;
+}}
+
+// Position of a cluster in the cluster array
+PB_TOPO_FUNC uint32_t pb_topo_cluster_x(uint32_t idx) {{ return idx / PB_TOPO_CLUSTER_DIM_Y; }}
+PB_TOPO_FUNC uint32_t pb_topo_cluster_y(uint32_t idx) {{ return idx % PB_TOPO_CLUSTER_DIM_Y; }}
+"""
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate the mesh topology header.')
+    parser.add_argument('-c', '--config', required=True, help='FlooNoC configuration file')
+    parser.add_argument('-o', '--output', required=True, help='Output header')
+    args = parser.parse_args()
+
+    with open(args.config) as f:
+        cfg = yaml.safe_load(f)
+    with open(args.output, 'w') as f:
+        f.write(render(cfg))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())